@@ -0,0 +1,47 @@
+//
+// Copyright (c) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#ifndef MultiPrecision_BarrettReducer_INCLUDED
+#define MultiPrecision_BarrettReducer_INCLUDED
+
+#include "MultiPrecision/Unsigned.h"
+#include <vector>
+
+namespace MultiPrecision {
+
+/// Reduction modulo a fixed modulus m of k digits by Barrett's method, replacing division with two multiplications by
+/// the reciprocal b^2k / m calculated once on construction, for digit base b. Applies to any modulus, including even
+/// ones. Algorithm 14.42 from Alfred J. Menezes, Paul C. van Oorschot, Scott A. Vanstone, "Handbook of Applied
+/// Cryptography", 1996, pp 604.
+class BarrettReducer
+{
+public:
+	explicit BarrettReducer(const Unsigned& modulus);
+	const Unsigned& getModulus() const noexcept;
+	// Remainder of n divided by the modulus, falling back to division for n of more than 2k digits.
+	Unsigned reduce(const Unsigned& n) const;
+	// Product lhs * rhs reduced by the modulus, for lhs and rhs less than the modulus.
+	Unsigned multiply(const Unsigned& lhs, const Unsigned& rhs) const;
+	// Power base^exponent reduced by the modulus.
+	Unsigned pow(const Unsigned& base, const Unsigned& exponent) const;
+	// Product of the powers bases[i]^exponents[i] reduced by the modulus.
+	Unsigned multiPow(const std::vector<Unsigned>& bases, const std::vector<Unsigned>& exponents) const;
+
+private:
+	static Unsigned nonZeroModulus(const Unsigned& modulus);
+	static Unsigned lowDigits(const Unsigned& n, std::size_t numberOfDigits);
+	static Unsigned highDigits(const Unsigned& n, std::size_t position);
+
+	const Unsigned modulus;
+	const std::size_t modulusLength;
+	// floor(b^2k / m)
+	const Unsigned reciprocal;
+};
+
+} // namespace MultiPrecision
+
+#endif // MultiPrecision_BarrettReducer_INCLUDED
@@ -0,0 +1,67 @@
+//
+// Copyright (c) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#ifndef MultiPrecision_DigitDivisor_INCLUDED
+#define MultiPrecision_DigitDivisor_INCLUDED
+
+#include "MultiPrecision/DigitPairType.h"
+#include "MultiPrecision/Unsigned.h"
+#include <limits>
+
+namespace MultiPrecision {
+
+/// Division by a fixed single digit divisor d, replacing the hardware division of two digits by one with multiplications
+/// by a reciprocal calculated once on construction. Pass it to Unsigned::dividedBy(), operator/=() or operator%= to
+/// divide repeatedly by the same small number. Algorithm 4 from Niels Möller, Torbjörn Granlund, "Improved division by
+/// invariant integers", IEEE Transactions on Computers 60 (2011), pp 165-175.
+class DigitDivisor
+{
+public:
+	using DigitType = Unsigned::DigitType;
+
+	explicit DigitDivisor(DigitType divisor);
+	DigitType getDivisor() const noexcept;
+
+	// Quotient of high * RADIX + low by the divisor, for high less than the divisor, storing the remainder.
+	DigitType divide(DigitType high, DigitType low, DigitType& remainder) const noexcept
+	{
+		if (shift) {
+			high = (high << shift) | (low >> (std::numeric_limits<DigitType>::digits - shift));
+			low <<= shift;
+		}
+		DigitPairType product =
+			DigitPairType(reciprocal) * high + ((DigitPairType(high) << std::numeric_limits<DigitType>::digits) | low);
+		DigitType quotient = DigitType(product >> std::numeric_limits<DigitType>::digits) + 1;
+		DigitType fraction = DigitType(product);
+		DigitType rest = low - quotient * normalizedDivisor;
+		if (rest > fraction) {
+			--quotient;
+			rest += normalizedDivisor;
+		}
+		if (rest >= normalizedDivisor) {
+			++quotient;
+			rest -= normalizedDivisor;
+		}
+		remainder = rest >> shift;
+		return quotient;
+	}
+
+private:
+	static DigitType nonZeroDivisor(DigitType divisor);
+	static int countLeadingZeros(DigitType divisor) noexcept;
+
+	const DigitType divisor;
+	// Divisor shifted left until its most significant bit is set, as required by the reciprocal.
+	const int shift;
+	const DigitType normalizedDivisor;
+	// floor((RADIX^2 - 1) / normalizedDivisor) - RADIX
+	const DigitType reciprocal;
+};
+
+} // namespace MultiPrecision
+
+#endif // MultiPrecision_DigitDivisor_INCLUDED
@@ -14,10 +14,15 @@
 
 namespace MultiPrecision {
 
-using DigitPairType = unsigned long;
-
-static_assert(std::is_integral<DigitPairType>::value);
-static_assert(std::is_unsigned<DigitPairType>::value);
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 DigitPairType;
+#else
+using DigitPairType = unsigned long long;
+#endif
+
+// Not std::is_integral and std::is_unsigned, which are false for extended integer types in strict ISO C++ mode.
+static_assert(std::numeric_limits<DigitPairType>::is_integer);
+static_assert(!std::numeric_limits<DigitPairType>::is_signed);
 static_assert(std::numeric_limits<DigitPairType>::digits >= 2 * std::numeric_limits<Unsigned::DigitType>::digits);
 
 } // namespace MultiPrecision
@@ -0,0 +1,47 @@
+//
+// Copyright (C) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#ifndef MultiPrecision_FixedBasePow_INCLUDED
+#define MultiPrecision_FixedBasePow_INCLUDED
+
+#include "MultiPrecision/BarrettReducer.h"
+#include "MultiPrecision/MontgomeryContext.h"
+#include "MultiPrecision/Unsigned.h"
+#include <optional>
+#include <vector>
+
+namespace MultiPrecision {
+
+/// Powers of a fixed base modulo a fixed modulus for exponents of up to a maximum number of bits, by fixed-base windowing.
+/// The powers g^(2^(w * i)) are calculated once on construction, and an exponent of t windows of w bits takes up to
+/// t + 2^w - 2 multiplications and no squarings. Reduction is by Montgomery's method for odd moduli, and by Barrett's
+/// for even ones, like the modular pow. Algorithm 14.109 from Alfred J. Menezes, Paul C. van Oorschot, Scott A.
+/// Vanstone, "Handbook of Applied Cryptography", 1996, pp 616.
+class FixedBasePow
+{
+public:
+	FixedBasePow(const Unsigned& base, const Unsigned& modulus, std::size_t maxExponentBits);
+	const Unsigned& getModulus() const noexcept;
+	// Power base^exponent reduced by the modulus, for exponents of up to maxExponentBits bits.
+	Unsigned pow(const Unsigned& exponent) const;
+
+private:
+	static std::size_t windowSizeOf(std::size_t maxExponentBits) noexcept;
+	Unsigned multiply(const Unsigned& lhs, const Unsigned& rhs) const;
+
+	std::optional<MontgomeryContext> montgomeryContext;
+	std::optional<BarrettReducer> barrettReducer;
+	const std::size_t maxExponentBits;
+	const std::size_t windowSize;
+	// Representation of 1, and powers[i] == base^(2^(windowSize * i)), in Montgomery representation for odd moduli.
+	Unsigned one;
+	std::vector<Unsigned> powers;
+};
+
+} // namespace MultiPrecision
+
+#endif // MultiPrecision_FixedBasePow_INCLUDED
@@ -0,0 +1,353 @@
+//
+// Copyright (c) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#ifndef MultiPrecision_FixedUnsigned_INCLUDED
+#define MultiPrecision_FixedUnsigned_INCLUDED
+
+#include "MultiPrecision/DigitPairType.h"
+#include "MultiPrecision/InvalidCharacter.h"
+#include "MultiPrecision/Overflow.h"
+#include "MultiPrecision/Unsigned.h"
+#include <array>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <string>
+
+namespace MultiPrecision {
+
+/// Unsigned integer of Bits bits, stored in a fixed number of digits without heap allocation. Like built-in unsigned
+/// integers, addition, subtraction, multiplication and left shifts are calculated modulo 2^Bits, and can be evaluated at
+/// compile time. Division, string conversion and streaming are delegated to Unsigned.
+template<std::size_t Bits>
+class FixedUnsigned
+{
+public:
+	using DigitType = Unsigned::DigitType;
+
+	static constexpr std::size_t DIGITS = Bits / std::numeric_limits<DigitType>::digits;
+	static_assert(DIGITS > 0 && Bits % std::numeric_limits<DigitType>::digits == 0);
+
+	constexpr FixedUnsigned() noexcept : digits()
+	{
+	}
+
+	explicit constexpr FixedUnsigned(unsigned long long n) noexcept : digits()
+	{
+		for (std::size_t i = 0; i < DIGITS && n; ++i) {
+			digits[i] = n & std::numeric_limits<DigitType>::max();
+			// Shift in two steps, as shifting by the full width of n is undefined for digits as wide as n.
+			n >>= std::numeric_limits<DigitType>::digits - 1;
+			n >>= 1;
+		}
+	}
+
+	template<std::size_t OtherBits>
+	explicit constexpr FixedUnsigned(const FixedUnsigned<OtherBits>& other) : digits()
+	{
+		for (std::size_t i = 0; i < other.DIGITS; ++i) {
+			if (i < DIGITS) {
+				digits[i] = other.digits[i];
+			} else if (other.digits[i]) {
+				throw Overflow("FixedUnsigned::FixedUnsigned(const FixedUnsigned<OtherBits>&): number too large!");
+			}
+		}
+	}
+
+	explicit FixedUnsigned(const Unsigned& n) : digits()
+	{
+		std::size_t length = n.mostSignificantDigitPosition();
+		if (length > DIGITS) {
+			throw Overflow("FixedUnsigned::FixedUnsigned(const Unsigned&): number too large!");
+		}
+		for (std::size_t i = 0; i < length; ++i) {
+			digits[i] = n.digits[i];
+		}
+	}
+
+	// Decimal, or with prefix 0x hexadecimal, 0b binary or 0 octal, parsed without Unsigned, so that constants can be
+	// constructed at compile time.
+	constexpr FixedUnsigned(const char* number) : digits()
+	{
+		DigitType radix = 10;
+		if (number[0] == '0' && (number[1] == 'x' || number[1] == 'X')) {
+			radix = 16;
+			number += 2;
+		} else if (number[0] == '0' && (number[1] == 'b' || number[1] == 'B')) {
+			radix = 2;
+			number += 2;
+		} else if (number[0] == '0') {
+			radix = 8;
+			number += 1;
+		}
+		for (; *number; ++number) {
+			DigitType value = valueOf(*number);
+			if (value >= radix) {
+				throw InvalidCharacter("FixedUnsigned::FixedUnsigned(const char*): invalid input!");
+			}
+			if (multiplyAdd(radix, value)) {
+				throw Overflow("FixedUnsigned::FixedUnsigned(const char*): number too large!");
+			}
+		}
+	}
+
+	FixedUnsigned(const std::string& number) : FixedUnsigned(number.c_str())
+	{
+	}
+
+	explicit operator Unsigned() const
+	{
+		Unsigned result;
+		result.digits.assign(digits.begin(), digits.end());
+		return result.trim();
+	}
+
+	constexpr FixedUnsigned& operator+=(const FixedUnsigned& other) noexcept
+	{
+		DigitType carry = 0;
+		for (std::size_t i = 0; i < DIGITS; ++i) {
+			DigitPairType tmp = DigitPairType(digits[i]) + other.digits[i] + carry;
+			digits[i] = tmp & std::numeric_limits<DigitType>::max();
+			carry = tmp >> std::numeric_limits<DigitType>::digits;
+		}
+		return *this;
+	}
+
+	constexpr FixedUnsigned& operator++() noexcept
+	{
+		for (std::size_t i = 0; i < DIGITS && !++digits[i]; ++i) {
+		}
+		return *this;
+	}
+
+	constexpr FixedUnsigned operator++(int) noexcept
+	{
+		FixedUnsigned result(*this);
+		++*this;
+		return result;
+	}
+
+	constexpr FixedUnsigned& operator-=(const FixedUnsigned& other) noexcept
+	{
+		DigitType borrow = 0;
+		for (std::size_t i = 0; i < DIGITS; ++i) {
+			DigitPairType tmp = DigitPairType(digits[i]) - other.digits[i] - borrow;
+			digits[i] = tmp & std::numeric_limits<DigitType>::max();
+			borrow = (tmp >> std::numeric_limits<DigitType>::digits) & 1;
+		}
+		return *this;
+	}
+
+	constexpr FixedUnsigned& operator--() noexcept
+	{
+		for (std::size_t i = 0; i < DIGITS && !digits[i]--; ++i) {
+		}
+		return *this;
+	}
+
+	constexpr FixedUnsigned operator--(int) noexcept
+	{
+		FixedUnsigned result(*this);
+		--*this;
+		return result;
+	}
+
+	// Schoolbook multiplication, omitting all partial products beyond the width of the result.
+	constexpr FixedUnsigned& operator*=(const FixedUnsigned& other) noexcept
+	{
+		std::array<DigitType, DIGITS> product{};
+		for (std::size_t j = 0; j < DIGITS; ++j) {
+			DigitType carry = 0;
+			for (std::size_t i = 0; i + j < DIGITS; ++i) {
+				DigitPairType tmp = DigitPairType(digits[i]) * other.digits[j] + product[i + j] + carry;
+				product[i + j] = tmp & std::numeric_limits<DigitType>::max();
+				carry = tmp >> std::numeric_limits<DigitType>::digits;
+			}
+		}
+		digits = product;
+		return *this;
+	}
+
+	FixedUnsigned& operator/=(const FixedUnsigned& other)
+	{
+		return *this = FixedUnsigned(Unsigned(*this) / Unsigned(other));
+	}
+
+	FixedUnsigned& operator%=(const FixedUnsigned& other)
+	{
+		return *this = FixedUnsigned(Unsigned(*this) % Unsigned(other));
+	}
+
+	constexpr FixedUnsigned& operator<<=(std::size_t bits) noexcept
+	{
+		std::size_t digitShift = bits / std::numeric_limits<DigitType>::digits;
+		std::size_t bitShift = bits % std::numeric_limits<DigitType>::digits;
+		for (std::size_t i = DIGITS; i-- > 0;) {
+			DigitType digit = i >= digitShift ? digits[i - digitShift] << bitShift : 0;
+			if (bitShift && i > digitShift) {
+				digit |= digits[i - digitShift - 1] >> (std::numeric_limits<DigitType>::digits - bitShift);
+			}
+			digits[i] = digit;
+		}
+		return *this;
+	}
+
+	constexpr FixedUnsigned& operator>>=(std::size_t bits) noexcept
+	{
+		std::size_t digitShift = bits / std::numeric_limits<DigitType>::digits;
+		std::size_t bitShift = bits % std::numeric_limits<DigitType>::digits;
+		for (std::size_t i = 0; i < DIGITS; ++i) {
+			DigitType digit = i + digitShift < DIGITS ? digits[i + digitShift] >> bitShift : 0;
+			if (bitShift && i + digitShift + 1 < DIGITS) {
+				digit |= digits[i + digitShift + 1] << (std::numeric_limits<DigitType>::digits - bitShift);
+			}
+			digits[i] = digit;
+		}
+		return *this;
+	}
+
+	constexpr bool isZero() const noexcept
+	{
+		DigitType any = 0;
+		for (std::size_t i = 0; i < DIGITS; ++i) {
+			any |= digits[i];
+		}
+		return !any;
+	}
+
+	std::string toDecimalString() const
+	{
+		return Unsigned(*this).toDecimalString();
+	}
+
+	std::string toHexadecimalString(bool uppercase = false) const
+	{
+		return Unsigned(*this).toHexadecimalString(uppercase);
+	}
+
+	std::string toOctalString() const
+	{
+		return Unsigned(*this).toOctalString();
+	}
+
+	friend constexpr FixedUnsigned operator+(FixedUnsigned lhs, const FixedUnsigned& rhs) noexcept
+	{
+		return lhs += rhs;
+	}
+
+	friend constexpr FixedUnsigned operator-(FixedUnsigned lhs, const FixedUnsigned& rhs) noexcept
+	{
+		return lhs -= rhs;
+	}
+
+	friend constexpr FixedUnsigned operator*(FixedUnsigned lhs, const FixedUnsigned& rhs) noexcept
+	{
+		return lhs *= rhs;
+	}
+
+	friend FixedUnsigned operator/(FixedUnsigned lhs, const FixedUnsigned& rhs)
+	{
+		return lhs /= rhs;
+	}
+
+	friend FixedUnsigned operator%(FixedUnsigned lhs, const FixedUnsigned& rhs)
+	{
+		return lhs %= rhs;
+	}
+
+	friend constexpr FixedUnsigned operator<<(FixedUnsigned n, std::size_t bits) noexcept
+	{
+		return n <<= bits;
+	}
+
+	friend constexpr FixedUnsigned operator>>(FixedUnsigned n, std::size_t bits) noexcept
+	{
+		return n >>= bits;
+	}
+
+	friend constexpr bool operator==(const FixedUnsigned& lhs, const FixedUnsigned& rhs) noexcept
+	{
+		return lhs.compare(rhs) == 0;
+	}
+
+	friend constexpr bool operator!=(const FixedUnsigned& lhs, const FixedUnsigned& rhs) noexcept
+	{
+		return lhs.compare(rhs) != 0;
+	}
+
+	friend constexpr bool operator<(const FixedUnsigned& lhs, const FixedUnsigned& rhs) noexcept
+	{
+		return lhs.compare(rhs) < 0;
+	}
+
+	friend constexpr bool operator<=(const FixedUnsigned& lhs, const FixedUnsigned& rhs) noexcept
+	{
+		return lhs.compare(rhs) <= 0;
+	}
+
+	friend constexpr bool operator>(const FixedUnsigned& lhs, const FixedUnsigned& rhs) noexcept
+	{
+		return lhs.compare(rhs) > 0;
+	}
+
+	friend constexpr bool operator>=(const FixedUnsigned& lhs, const FixedUnsigned& rhs) noexcept
+	{
+		return lhs.compare(rhs) >= 0;
+	}
+
+	friend std::istream& operator>>(std::istream& in, FixedUnsigned& out)
+	{
+		Unsigned n;
+		in >> n;
+		out = FixedUnsigned(n);
+		return in;
+	}
+
+	friend std::ostream& operator<<(std::ostream& out, const FixedUnsigned& in)
+	{
+		return out << Unsigned(in);
+	}
+
+private:
+	static constexpr DigitType valueOf(char c) noexcept
+	{
+		return c >= '0' && c <= '9' ? c - '0' :
+			c >= 'a' && c <= 'z' ? c - 'a' + 10 :
+			c >= 'A' && c <= 'Z' ? c - 'A' + 10 : std::numeric_limits<DigitType>::max();
+	}
+
+	// Replace the number by number * factor + addend, returning the digit carried out.
+	constexpr DigitType multiplyAdd(DigitType factor, DigitType addend) noexcept
+	{
+		DigitType carry = addend;
+		for (std::size_t i = 0; i < DIGITS; ++i) {
+			DigitPairType tmp = DigitPairType(digits[i]) * factor + carry;
+			digits[i] = tmp & std::numeric_limits<DigitType>::max();
+			carry = tmp >> std::numeric_limits<DigitType>::digits;
+		}
+		return carry;
+	}
+
+	constexpr int compare(const FixedUnsigned& other) const noexcept
+	{
+		for (std::size_t i = DIGITS; i-- > 0;) {
+			if (digits[i] != other.digits[i]) {
+				return digits[i] < other.digits[i] ? -1 : 1;
+			}
+		}
+		return 0;
+	}
+
+	template<std::size_t OtherBits>
+	friend class FixedUnsigned;
+
+	std::array<DigitType, DIGITS> digits;
+};
+
+} // namespace MultiPrecision
+
+#endif // MultiPrecision_FixedUnsigned_INCLUDED
@@ -0,0 +1,24 @@
+//
+// Copyright (c) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#ifndef MultiPrecision_InvalidModulus_INCLUDED
+#define MultiPrecision_InvalidModulus_INCLUDED
+
+#include "MultiPrecision/Error.h"
+
+namespace MultiPrecision {
+
+class InvalidModulus : Error
+{
+public:
+	InvalidModulus(const std::string what);
+	virtual ~InvalidModulus();
+};
+
+} // namespace MultiPrecision
+
+#endif // MultiPrecision_InvalidModulus_INCLUDED
@@ -0,0 +1,87 @@
+//
+// Copyright (c) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#ifndef MultiPrecision_LimbAllocator_INCLUDED
+#define MultiPrecision_LimbAllocator_INCLUDED
+
+#include <cstddef>
+
+namespace MultiPrecision {
+
+/// Source of the heap storage of digits exceeding those stored inline in Unsigned numbers. Numbers allocate from the
+/// allocator current at their construction, which is the one installed by the innermost LimbAllocator::Scope of the
+/// thread, or the global heap outside of any scope, except for copies and moves, which allocate from the allocator of
+/// the original. The allocator must outlive all numbers allocated from it. Assigning a number to one of another
+/// allocator copies its digits.
+class LimbAllocator
+{
+public:
+	class Scope;
+	template<typename T>
+	class Adapter;
+
+	virtual ~LimbAllocator();
+	virtual void* allocate(std::size_t bytes) = 0;
+	virtual void deallocate(void* storage, std::size_t bytes) noexcept = 0;
+
+	// Allocator installed for the calling thread.
+	static LimbAllocator& current() noexcept;
+	// Allocator using global operator new and delete.
+	static LimbAllocator& heap() noexcept;
+};
+
+/// Installs an allocator for the calling thread for the lifetime of the scope, restoring the previous one afterwards.
+class LimbAllocator::Scope
+{
+public:
+	explicit Scope(LimbAllocator& allocator) noexcept;
+	Scope(const Scope&) = delete;
+	Scope& operator=(const Scope&) = delete;
+	~Scope();
+
+private:
+	LimbAllocator* previous;
+};
+
+/// Standard allocator interface to the allocator current at construction.
+template<typename T>
+class LimbAllocator::Adapter
+{
+public:
+	using value_type = T;
+
+	Adapter() noexcept : allocator(&current())
+	{
+	}
+
+	friend bool operator==(const Adapter& lhs, const Adapter& rhs) noexcept
+	{
+		return lhs.allocator == rhs.allocator;
+	}
+
+	friend bool operator!=(const Adapter& lhs, const Adapter& rhs) noexcept
+	{
+		return lhs.allocator != rhs.allocator;
+	}
+
+	T* allocate(std::size_t n)
+	{
+		return static_cast<T*>(allocator->allocate(n * sizeof(T)));
+	}
+
+	void deallocate(T* p, std::size_t n) noexcept
+	{
+		allocator->deallocate(p, n * sizeof(T));
+	}
+
+private:
+	LimbAllocator* allocator;
+};
+
+} // namespace MultiPrecision
+
+#endif // MultiPrecision_LimbAllocator_INCLUDED
@@ -0,0 +1,56 @@
+//
+// Copyright (c) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#ifndef MultiPrecision_LimbPool_INCLUDED
+#define MultiPrecision_LimbPool_INCLUDED
+
+#include "MultiPrecision/LimbAllocator.h"
+#include <vector>
+
+namespace MultiPrecision {
+
+/// Allocator recycling storage in size classes of powers of 2, carved from larger slabs. Released storage is kept for
+/// reuse until reset, which returns all slabs to the heap at once. A pool is not thread safe, and all numbers allocated
+/// from it must be destroyed before it is reset or destroyed itself. Typical use for a computation of short lived numbers:
+///
+///     {
+///         LimbAllocator::Scope scope(LimbPool::threadLocal());
+///         ...
+///     }
+///     LimbPool::threadLocal().reset();
+class LimbPool : public LimbAllocator
+{
+public:
+	LimbPool();
+	LimbPool(const LimbPool&) = delete;
+	LimbPool& operator=(const LimbPool&) = delete;
+	~LimbPool();
+	virtual void* allocate(std::size_t bytes) override;
+	virtual void deallocate(void* storage, std::size_t bytes) noexcept override;
+	void reset() noexcept;
+
+	// Pool owned by the calling thread.
+	static LimbPool& threadLocal();
+
+private:
+	struct FreeBlock;
+
+	static constexpr std::size_t MIN_BLOCK_SIZE_LOG2 = 5;
+	static constexpr std::size_t MAX_BLOCK_SIZE_LOG2 = 20;
+	static constexpr std::size_t SLAB_SIZE = std::size_t(1) << MAX_BLOCK_SIZE_LOG2;
+
+	static std::size_t sizeClass(std::size_t bytes) noexcept;
+
+	std::vector<void*> slabs;
+	char* slabCursor;
+	std::size_t slabRemaining;
+	FreeBlock* freeBlocks[MAX_BLOCK_SIZE_LOG2 - MIN_BLOCK_SIZE_LOG2 + 1];
+};
+
+} // namespace MultiPrecision
+
+#endif // MultiPrecision_LimbPool_INCLUDED
@@ -0,0 +1,52 @@
+//
+// Copyright (c) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#ifndef MultiPrecision_MontgomeryContext_INCLUDED
+#define MultiPrecision_MontgomeryContext_INCLUDED
+
+#include "MultiPrecision/Unsigned.h"
+#include <vector>
+
+namespace MultiPrecision {
+
+/// Arithmetic modulo an odd number N in Montgomery's representation x * R mod N, with R = 2^(digit bits * digits of N),
+/// replacing division by N with multiplications and shifts. Constants depending on N are calculated once on
+/// construction. See Peter L. Montgomery, "Modular Multiplication Without Trial Division", Mathematics of
+/// Computation 44 (1985), pp 519-521.
+class MontgomeryContext
+{
+public:
+	explicit MontgomeryContext(const Unsigned& modulus);
+	const Unsigned& getModulus() const noexcept;
+	// Conversion of n to and from Montgomery representation.
+	Unsigned toMontgomery(const Unsigned& n) const;
+	Unsigned fromMontgomery(const Unsigned& n) const;
+	// Montgomery product lhs * rhs / R mod N of numbers in Montgomery representation.
+	Unsigned multiply(const Unsigned& lhs, const Unsigned& rhs) const;
+	// Power base^exponent mod N of a number in plain representation.
+	Unsigned pow(const Unsigned& base, const Unsigned& exponent) const;
+	// Product of the powers bases[i]^exponents[i] mod N of numbers in plain representation.
+	Unsigned multiPow(const std::vector<Unsigned>& bases, const std::vector<Unsigned>& exponents) const;
+
+private:
+	using DigitType = Unsigned::DigitType;
+
+	static Unsigned oddModulus(const Unsigned& modulus);
+	void multiply(const Unsigned& lhs, const Unsigned& rhs, Unsigned& product) const;
+
+	const Unsigned modulus;
+	const std::size_t modulusLength;
+	// -N^-1 mod 2^(digit bits)
+	const DigitType negatedInverse;
+	// R^2 mod N, and R mod N representing 1.
+	const Unsigned rSquared;
+	const Unsigned one;
+};
+
+} // namespace MultiPrecision
+
+#endif // MultiPrecision_MontgomeryContext_INCLUDED
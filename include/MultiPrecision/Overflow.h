@@ -0,0 +1,24 @@
+//
+// Copyright (c) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#ifndef MultiPrecision_Overflow_INCLUDED
+#define MultiPrecision_Overflow_INCLUDED
+
+#include "MultiPrecision/Error.h"
+
+namespace MultiPrecision {
+
+class Overflow : Error
+{
+public:
+	Overflow(const std::string what);
+	virtual ~Overflow();
+};
+
+} // namespace MultiPrecision
+
+#endif // MultiPrecision_Overflow_INCLUDED
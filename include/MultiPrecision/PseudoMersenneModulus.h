@@ -0,0 +1,58 @@
+//
+// Copyright (C) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#ifndef MultiPrecision_PseudoMersenneModulus_INCLUDED
+#define MultiPrecision_PseudoMersenneModulus_INCLUDED
+
+#include "MultiPrecision/Unsigned.h"
+#include <vector>
+
+namespace MultiPrecision {
+
+/// Reduction modulo m = 2^k - c, for 0 < c <= 2^(k - 1), by folding n = h * 2^k + l to h * c + l, which is congruent modulo
+/// m, until less than 2^k, and subtracting m at most once. Reduction takes shifts, multiplications by c and additions
+/// only, and is linear in the length of n for c of few digits, like for 2^255 - 19 of Curve25519. Sparse c, like that of
+/// NIST's Solinas primes, take a few more folds. Algorithm 14.47 from Alfred J. Menezes, Paul C. van Oorschot, Scott A.
+/// Vanstone, "Handbook of Applied Cryptography", 1996, pp 605.
+class PseudoMersenneModulus
+{
+public:
+	PseudoMersenneModulus(std::size_t k, const Unsigned& c);
+	// The modulus given as is, of at least 2, reducing fast if it satisfies isApplicable().
+	explicit PseudoMersenneModulus(const Unsigned& modulus);
+	// Whether modulus is 2^k - c with c of a single digit and at most half the bits of the modulus, or of at most a quarter
+	// of them, reducing faster than by division or Montgomery multiplication.
+	static bool isApplicable(const Unsigned& modulus);
+	const Unsigned& getModulus() const noexcept;
+	// Remainder of n divided by the modulus.
+	Unsigned reduce(const Unsigned& n) const;
+	// Product lhs * rhs reduced by the modulus.
+	Unsigned multiply(const Unsigned& lhs, const Unsigned& rhs) const;
+	// Power base^exponent reduced by the modulus.
+	Unsigned pow(const Unsigned& base, const Unsigned& exponent) const;
+	// Product of the powers bases[i]^exponents[i] reduced by the modulus.
+	Unsigned multiPow(const std::vector<Unsigned>& bases, const std::vector<Unsigned>& exponents) const;
+
+private:
+	using DigitType = Unsigned::DigitType;
+
+	// Operand length in digits up to which schoolbook multiplication without allocation outperforms that of Unsigned.
+	static constexpr std::size_t SCHOOLBOOK_LENGTH = 16;
+
+	static Unsigned cOf(const Unsigned& modulus);
+	static Unsigned modulusOf(std::size_t k, const Unsigned& c);
+	void multiply(const Unsigned& lhs, const Unsigned& rhs, Unsigned& product) const;
+	void reduceInPlace(Unsigned& n) const;
+
+	const std::size_t k;
+	const Unsigned c;
+	const Unsigned modulus;
+};
+
+} // namespace MultiPrecision
+
+#endif // MultiPrecision_PseudoMersenneModulus_INCLUDED
@@ -0,0 +1,24 @@
+//
+// Copyright (c) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#ifndef MultiPrecision_SizeMismatch_INCLUDED
+#define MultiPrecision_SizeMismatch_INCLUDED
+
+#include "MultiPrecision/Error.h"
+
+namespace MultiPrecision {
+
+class SizeMismatch : Error
+{
+public:
+	SizeMismatch(const std::string what);
+	virtual ~SizeMismatch();
+};
+
+} // namespace MultiPrecision
+
+#endif // MultiPrecision_SizeMismatch_INCLUDED
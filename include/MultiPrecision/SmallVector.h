@@ -0,0 +1,352 @@
+//
+// Copyright (C) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#ifndef MultiPrecision_SmallVector_INCLUDED
+#define MultiPrecision_SmallVector_INCLUDED
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+namespace MultiPrecision {
+
+/// Sequence of trivial elements with the interface of std::vector, storing up to N elements inline and allocating
+/// storage on the heap only beyond that. Like std::vector, a moved from SmallVector is empty, and ranges passed to
+/// assign and insert must not refer to elements of the same SmallVector. Heap storage comes from the allocator given
+/// at construction, which is taken over by copy and move construction. Move assignment takes over the storage of the
+/// other SmallVector only if both allocators compare equal, and copies its elements otherwise.
+template<typename T, std::size_t N, typename Allocator = std::allocator<T>>
+class SmallVector
+{
+public:
+	static_assert(std::is_trivial<T>::value);
+	static_assert(N > 0);
+
+	using value_type = T;
+	using size_type = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using reference = T&;
+	using const_reference = const T&;
+	using pointer = T*;
+	using const_pointer = const T*;
+	using iterator = T*;
+	using const_iterator = const T*;
+	using reverse_iterator = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+	explicit SmallVector(const Allocator& allocator = Allocator()) noexcept :
+		first(inlineElements),
+		length(0),
+		reserved(N),
+		allocator(allocator)
+	{
+	}
+
+	SmallVector(const SmallVector& other) : SmallVector(other.allocator)
+	{
+		assign(other.begin(), other.end());
+	}
+
+	SmallVector(SmallVector&& other) noexcept : SmallVector(other.allocator)
+	{
+		steal(other);
+	}
+
+	~SmallVector()
+	{
+		release();
+	}
+
+	SmallVector& operator=(const SmallVector& other)
+	{
+		if (this != &other) {
+			assign(other.begin(), other.end());
+		}
+		return *this;
+	}
+
+	SmallVector& operator=(SmallVector&& other)
+	{
+		if (this != &other) {
+			if (allocator == other.allocator) {
+				release();
+				steal(other);
+			} else {
+				assign(other.begin(), other.end());
+				other.clear();
+			}
+		}
+		return *this;
+	}
+
+	Allocator get_allocator() const noexcept
+	{
+		return allocator;
+	}
+
+	iterator begin() noexcept
+	{
+		return first;
+	}
+
+	const_iterator begin() const noexcept
+	{
+		return first;
+	}
+
+	iterator end() noexcept
+	{
+		return first + length;
+	}
+
+	const_iterator end() const noexcept
+	{
+		return first + length;
+	}
+
+	reverse_iterator rbegin() noexcept
+	{
+		return reverse_iterator(end());
+	}
+
+	const_reverse_iterator rbegin() const noexcept
+	{
+		return const_reverse_iterator(end());
+	}
+
+	reverse_iterator rend() noexcept
+	{
+		return reverse_iterator(begin());
+	}
+
+	const_reverse_iterator rend() const noexcept
+	{
+		return const_reverse_iterator(begin());
+	}
+
+	bool empty() const noexcept
+	{
+		return length == 0;
+	}
+
+	size_type size() const noexcept
+	{
+		return length;
+	}
+
+	size_type capacity() const noexcept
+	{
+		return reserved;
+	}
+
+	T* data() noexcept
+	{
+		return first;
+	}
+
+	const T* data() const noexcept
+	{
+		return first;
+	}
+
+	T& operator[](size_type position) noexcept
+	{
+		return first[position];
+	}
+
+	const T& operator[](size_type position) const noexcept
+	{
+		return first[position];
+	}
+
+	T& at(size_type position)
+	{
+		if (position >= length) {
+			throw std::out_of_range("SmallVector::at(size_type): position out of range!");
+		}
+		return first[position];
+	}
+
+	const T& at(size_type position) const
+	{
+		if (position >= length) {
+			throw std::out_of_range("SmallVector::at(size_type): position out of range!");
+		}
+		return first[position];
+	}
+
+	T& front() noexcept
+	{
+		return first[0];
+	}
+
+	const T& front() const noexcept
+	{
+		return first[0];
+	}
+
+	T& back() noexcept
+	{
+		return first[length - 1];
+	}
+
+	const T& back() const noexcept
+	{
+		return first[length - 1];
+	}
+
+	void reserve(size_type newCapacity)
+	{
+		if (newCapacity > reserved) {
+			T* elements = allocator.allocate(newCapacity);
+			std::copy(first, first + length, elements);
+			release();
+			first = elements;
+			reserved = newCapacity;
+		}
+	}
+
+	void clear() noexcept
+	{
+		length = 0;
+	}
+
+	void resize(size_type newSize)
+	{
+		resize(newSize, T());
+	}
+
+	void resize(size_type newSize, const T& value)
+	{
+		if (newSize > length) {
+			grow(newSize);
+			std::fill(first + length, first + newSize, value);
+		}
+		length = newSize;
+	}
+
+	void assign(size_type count, const T& value)
+	{
+		length = 0;
+		resize(count, value);
+	}
+
+	template<typename InputIterator, typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+	void assign(InputIterator from, InputIterator to)
+	{
+		length = 0;
+		insert(end(), from, to);
+	}
+
+	void push_back(const T& value)
+	{
+		if (length == reserved) {
+			// Copy first, as value may refer to an element of this vector.
+			T copy = value;
+			grow(length + 1);
+			first[length++] = copy;
+		} else {
+			first[length++] = value;
+		}
+	}
+
+	void pop_back() noexcept
+	{
+		--length;
+	}
+
+	iterator insert(const_iterator position, size_type count, const T& value)
+	{
+		T copy = value;
+		iterator gap = openGap(position, count);
+		std::fill(gap, gap + count, copy);
+		return gap;
+	}
+
+	template<typename InputIterator, typename = typename std::enable_if<!std::is_integral<InputIterator>::value>::type>
+	iterator insert(const_iterator position, InputIterator from, InputIterator to)
+	{
+		iterator gap = openGap(position, std::distance(from, to));
+		std::copy(from, to, gap);
+		return gap;
+	}
+
+	iterator erase(const_iterator from, const_iterator to) noexcept
+	{
+		iterator gap = first + (from - first);
+		std::copy(to, const_iterator(end()), gap);
+		length -= to - from;
+		return gap;
+	}
+
+	void swap(SmallVector& other)
+	{
+		SmallVector tmp(std::move(other));
+		other = std::move(*this);
+		*this = std::move(tmp);
+	}
+
+private:
+	bool isInline() const noexcept
+	{
+		return first == inlineElements;
+	}
+
+	// Grow capacity geometrically, to keep repeated appends amortized linear.
+	void grow(size_type minimumCapacity)
+	{
+		if (minimumCapacity > reserved) {
+			reserve(std::max(minimumCapacity, 2 * reserved));
+		}
+	}
+
+	iterator openGap(const_iterator position, size_type count)
+	{
+		size_type offset = position - first;
+		grow(length + count);
+		std::copy_backward(first + offset, first + length, first + length + count);
+		length += count;
+		return first + offset;
+	}
+
+	void release() noexcept
+	{
+		if (!isInline()) {
+			allocator.deallocate(first, reserved);
+			first = inlineElements;
+			reserved = N;
+		}
+	}
+
+	// Take over the heap storage of other, or copy its inline elements, leaving other empty.
+	void steal(SmallVector& other) noexcept
+	{
+		if (other.isInline()) {
+			std::copy(other.first, other.first + other.length, inlineElements);
+		} else {
+			first = other.first;
+			reserved = other.reserved;
+			other.first = other.inlineElements;
+			other.reserved = N;
+		}
+		length = other.length;
+		other.length = 0;
+	}
+
+	T* first;
+	size_type length;
+	size_type reserved;
+	T inlineElements[N];
+	Allocator allocator;
+};
+
+} // namespace MultiPrecision
+
+#endif // MultiPrecision_SmallVector_INCLUDED
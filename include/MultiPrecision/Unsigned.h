@@ -8,17 +8,33 @@
 #ifndef MultiPrecision_Unsigned_INCLUDED
 #define MultiPrecision_Unsigned_INCLUDED
 
+#include "MultiPrecision/LimbAllocator.h"
+#include "MultiPrecision/SmallVector.h"
+#include <charconv>
 #include <istream>
+#include <limits>
 #include <ostream>
 #include <string>
-#include <vector>
 
 namespace MultiPrecision {
 
+template<std::size_t Bits>
+class FixedUnsigned;
+class MontgomeryContext;
+class BarrettReducer;
+class PseudoMersenneModulus;
+class DigitDivisor;
+struct GcdExtendedResult;
+
 class Unsigned
 {
 public:
+	// Digits of half the width of the widest available unsigned integer type, which holds products of two digits.
+#if defined(__SIZEOF_INT128__)
+	using DigitType = unsigned long long;
+#else
 	using DigitType = unsigned int;
+#endif
 	static_assert(std::is_integral<DigitType>::value);
 	static_assert(std::is_unsigned<DigitType>::value);
 
@@ -26,6 +42,12 @@ public:
 	class MinimalBitRange;
 	class FullBitRange;
 	struct DivisionResult;
+	// Order of bytes in binary import and export, in the style of mpz_import() and mpz_export() of GMP.
+	enum class ByteOrder
+	{
+		MOST_SIGNIFICANT_FIRST,
+		LEAST_SIGNIFICANT_FIRST
+	};
 
 	Unsigned();
 	Unsigned(const Unsigned& other);
@@ -47,6 +69,9 @@ public:
 	DivisionResult dividedBy(const Unsigned& other) const;
 	Unsigned& operator/=(const Unsigned& other);
 	Unsigned& operator%=(const Unsigned& other);
+	DivisionResult dividedBy(const DigitDivisor& divisor) const;
+	Unsigned& operator/=(const DigitDivisor& divisor);
+	Unsigned& operator%=(const DigitDivisor& divisor);
 	Unsigned& operator<<=(std::size_t bits);
 	Unsigned& operator>>=(std::size_t bits);
 	static void read(std::istream& in, Unsigned& out);
@@ -59,13 +84,32 @@ public:
 	std::string toDecimalString() const;
 	std::string toHexadecimalString(bool uppercase = false) const;
 	std::string toOctalString() const;
+	// Conversion to and from characters of base 10, 2, 4, 8, 16 or 32 without prefix, in the style of std::to_chars() and
+	// std::from_chars(). Errors are reported by the result instead of exceptions, and no strings are allocated. Failure
+	// to allocate the digits of value or of intermediate numbers is reported as std::errc::not_enough_memory.
+	std::to_chars_result toChars(char* first, char* last, int base = 10) const noexcept;
+	static std::from_chars_result fromChars(const char* first, const char* last, Unsigned& value, int base = 10) noexcept;
+	std::size_t decimalDigitsUpperBound() const noexcept;
+	// Binary export into exactly length bytes, padded with zeros, and import, with bytes of the given order.
+	void toBytes(unsigned char* first, std::size_t length, ByteOrder order = ByteOrder::MOST_SIGNIFICANT_FIRST) const;
+	static Unsigned
+	fromBytes(const unsigned char* first, std::size_t length, ByteOrder order = ByteOrder::MOST_SIGNIFICANT_FIRST);
+	std::size_t numberOfBytes() const noexcept;
 	bool isZero() const noexcept;
+	bool isOdd() const noexcept;
 	MinimalBitRange minimalBitRange() const noexcept;
 	FullBitRange fullBitRange() const noexcept;
 	std::size_t mostSignificantBitPosition() const noexcept;
 	std::size_t numberOfDigits() const noexcept;
+	// Direct access to the numberOfDigits() digits, least significant first.
+	DigitType* digitData() noexcept;
+	const DigitType* digitData() const noexcept;
 	Unsigned& resize(std::size_t numberOfDigits);
 	Unsigned& trim();
+	// Remainder modulo 2^k, quotient by 2^k, and remainder modulo 2^k - 1, in time linear in the number of digits.
+	Unsigned modPow2(std::size_t k) const;
+	Unsigned divPow2(std::size_t k) const;
+	Unsigned modMersenne(std::size_t k) const;
 
 private:
 	class AdditionOfUnsigned;
@@ -75,6 +119,9 @@ private:
 	class MultiplicationWithUnsigned;
 	class MultiplicationWithDigitType;
 	class DivisionByUnsigned;
+	class RecursiveDivisionByUnsigned;
+	class DivisionBySpecialForm;
+	class GreatestCommonDivisor;
 	class DivisionByDigitType;
 	class LeftShift;
 	class RightShift;
@@ -82,6 +129,16 @@ private:
 	class LessThanComparison;
 	class LessThanOrEqualComparison;
 	class StringReadBuffer;
+	class DecimalFormatting;
+	class DecimalParsing;
+	class PowerOfTwoRadixConversion;
+
+	enum class DivisionParts
+	{
+		QUOTIENT,
+		REMAINDER,
+		QUOTIENT_AND_REMAINDER
+	};
 
 	Unsigned& operator+=(DigitType other);
 	Unsigned& operator-=(DigitType other);
@@ -90,6 +147,18 @@ private:
 	DivisionResult dividedBy(DigitType divisor) const;
 	Unsigned& operator/=(DigitType divisor);
 	Unsigned& operator%=(DigitType divisor);
+	// Division of dividend by a non-zero divisor by the fastest applicable algorithm, calculating the parts requested,
+	// and leaving others zero.
+	static DivisionResult divide(const Unsigned& dividend, const Unsigned& divisor, DivisionParts parts);
+	// Replace the number by its quotient, and return the remainder.
+	DigitType divideInPlace(const DigitDivisor& divisor);
+	// Write decimal digits into first up to first + length, of at least as many as there are, and return their end.
+	char* formatDecimal(char* first, std::size_t length) const;
+	// Write the number padded to length characters of bitsPerCharacter bits each into first.
+	void formatPowerOfTwoRadix(char* first, std::size_t length, std::size_t bitsPerCharacter, const char* characters) const;
+	// Convert valid characters of the respective radix.
+	static Unsigned parseDecimal(const char* first, const char* last);
+	static Unsigned parsePowerOfTwoRadix(const char* first, const char* last, std::size_t bitsPerCharacter);
 
 	bool subtractAndTestNegative(const Unsigned& other);
 	std::size_t mostSignificantDigitPosition() const noexcept;
@@ -104,14 +173,26 @@ private:
 	friend Unsigned operator+(const Unsigned& lhs, const Unsigned& rhs);
 	friend Unsigned operator-(const Unsigned& lhs, const Unsigned& rhs);
 	friend Unsigned operator*(const Unsigned& lhs, const Unsigned& rhs);
+	friend Unsigned square(const Unsigned& n);
+	friend Unsigned gcd(const Unsigned& a, const Unsigned& b);
+	friend GcdExtendedResult gcdExtended(const Unsigned& a, const Unsigned& b);
 	friend Unsigned operator/(const Unsigned& lhs, const Unsigned& rhs);
 	friend Unsigned operator%(const Unsigned& lhs, const Unsigned& rhs);
 	friend Unsigned operator<<(const Unsigned& n, std::size_t bits);
 	friend Unsigned operator>>(const Unsigned& n, std::size_t bits);
 	friend std::istream& operator>>(std::istream& in, Unsigned& out);
 	friend std::ostream& operator<<(std::ostream& out, const Unsigned& in);
+	template<std::size_t Bits>
+	friend class FixedUnsigned;
+	friend class MontgomeryContext;
+	friend class BarrettReducer;
+	friend class PseudoMersenneModulus;
+
+	// Number of digits stored without heap allocation, covering most numbers up to 256 bits. Further digits are allocated
+	// by the LimbAllocator current at construction of the number, or by that of the original for copies and moves.
+	static constexpr std::size_t INLINE_DIGITS = 256 / std::numeric_limits<DigitType>::digits;
 
-	std::vector<DigitType> digits;
+	SmallVector<DigitType, INLINE_DIGITS, LimbAllocator::Adapter<DigitType>> digits;
 };
 
 struct Unsigned::DivisionResult
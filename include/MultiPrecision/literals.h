@@ -0,0 +1,96 @@
+//
+// Copyright (c) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#ifndef MultiPrecision_literals_INCLUDED
+#define MultiPrecision_literals_INCLUDED
+
+#include "MultiPrecision/FixedUnsigned.h"
+#include "MultiPrecision/Unsigned.h"
+#include <algorithm>
+#include <array>
+#include <limits>
+
+namespace MultiPrecision {
+
+/// Compile time analysis of the characters of integer literals, which may contain digit separators.
+class LiteralCharacters
+{
+public:
+	// Bits for any literal with the radix and number of digits of characters, rounded up to whole digits.
+	template<std::size_t N>
+	static constexpr std::size_t bits(const std::array<char, N>& characters)
+	{
+		std::size_t prefixLength = 0;
+		std::size_t bitsPerDigit = 0;
+		if (characters[0] == '0' && (characters[1] == 'x' || characters[1] == 'X')) {
+			prefixLength = 2;
+			bitsPerDigit = 4;
+		} else if (characters[0] == '0' && (characters[1] == 'b' || characters[1] == 'B')) {
+			prefixLength = 2;
+			bitsPerDigit = 1;
+		} else if (characters[0] == '0') {
+			prefixLength = 1;
+			bitsPerDigit = 3;
+		}
+		std::size_t numberOfDigits = 0;
+		for (std::size_t i = prefixLength; i < N; ++i) {
+			if (characters[i] && characters[i] != '\'') {
+				++numberOfDigits;
+			}
+		}
+		// Decimal digits carry log2(10) < 3.322 bits each.
+		std::size_t bits = bitsPerDigit ? bitsPerDigit * numberOfDigits : (numberOfDigits * 3322 + 999) / 1000;
+		constexpr std::size_t digitBits = std::numeric_limits<Unsigned::DigitType>::digits;
+		return std::max((bits + digitBits - 1) / digitBits, std::size_t(1)) * digitBits;
+	}
+
+	template<std::size_t N>
+	static constexpr std::array<char, N> withoutSeparators(const std::array<char, N>& characters)
+	{
+		std::array<char, N> result{};
+		std::size_t length = 0;
+		for (char c : characters) {
+			if (c != '\'') {
+				result[length++] = c;
+			}
+		}
+		return result;
+	}
+};
+
+/// Value of the integer literal spelled by Chars, calculated at compile time.
+template<char... Chars>
+class Literal
+{
+public:
+	static constexpr std::array<char, sizeof...(Chars) + 1> CHARACTERS = {Chars..., '\0'};
+	static constexpr std::size_t BITS = LiteralCharacters::bits(CHARACTERS);
+	static constexpr FixedUnsigned<BITS> VALUE = FixedUnsigned<BITS>(LiteralCharacters::withoutSeparators(CHARACTERS).data());
+};
+
+inline namespace literals {
+
+/// Integer literal as FixedUnsigned constant, e.g. 0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffed_u,
+/// as wide as needed for any literal of its radix and number of digits.
+template<char... Chars>
+constexpr auto operator""_u()
+{
+	return Literal<Chars...>::VALUE;
+}
+
+/// Integer literal as Unsigned, copied from a FixedUnsigned constant without parsing at run time.
+template<char... Chars>
+Unsigned operator""_mp()
+{
+	return Unsigned(Literal<Chars...>::VALUE);
+}
+
+} // namespace literals
+
+} // namespace MultiPrecision
+
+#endif // MultiPrecision_literals_INCLUDED
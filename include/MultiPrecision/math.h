@@ -8,14 +8,44 @@
 #ifndef MultiPrecision_math_INCLUDED
 #define MultiPrecision_math_INCLUDED
 
+#include "MultiPrecision/BarrettReducer.h"
+#include "MultiPrecision/FixedBasePow.h"
+#include "MultiPrecision/MontgomeryContext.h"
+#include "MultiPrecision/PseudoMersenneModulus.h"
 #include "MultiPrecision/Unsigned.h"
+#include <vector>
 
 namespace MultiPrecision {
 
+Unsigned square(const Unsigned& n);
+
 Unsigned pow(const Unsigned& base, const Unsigned& exponent);
 
 Unsigned pow(const Unsigned& base, const Unsigned& exponent, const Unsigned& modulus);
 
+Unsigned powm(const Unsigned& base, const Unsigned& exponent, const MontgomeryContext& context);
+
+Unsigned multiPow(const std::vector<Unsigned>& bases, const std::vector<Unsigned>& exponents, const Unsigned& modulus);
+
+// Greatest common divisor of a and b, and coefficients x and y of a * x + b * y == gcd, by magnitude and sign. At most one
+// of them is negative, and unless a or b is 0, |x| <= b / gcd and |y| <= a / gcd.
+struct GcdExtendedResult
+{
+	Unsigned gcd;
+	Unsigned x;
+	Unsigned y;
+	bool xNegative;
+	bool yNegative;
+};
+
+// Greatest common divisor, 0 for a and b both 0.
+Unsigned gcd(const Unsigned& a, const Unsigned& b);
+
+// Least common multiple, 0 for a or b being 0.
+Unsigned lcm(const Unsigned& a, const Unsigned& b);
+
+GcdExtendedResult gcdExtended(const Unsigned& a, const Unsigned& b);
+
 } // namespace MultiPrecision
 
 #endif // MultiPrecision_math_INCLUDED
@@ -0,0 +1,106 @@
+//
+// Copyright (C) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#include "MultiPrecision/BarrettReducer.h"
+#include "MultiPrecision/DivisionByZero.h"
+#include "MultiPrecision/SizeMismatch.h"
+#include "MultiPrecision/SlidingWindowExponentiation.h"
+#include "MultiPrecision/math.h"
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace MultiPrecision {
+
+BarrettReducer::BarrettReducer(const Unsigned& modulus) :
+	modulus(nonZeroModulus(modulus)),
+	modulusLength(this->modulus.numberOfDigits()),
+	reciprocal((Unsigned(1) << (2 * modulusLength * std::numeric_limits<Unsigned::DigitType>::digits)) / this->modulus)
+{
+}
+
+const Unsigned& BarrettReducer::getModulus() const noexcept
+{
+	return modulus;
+}
+
+Unsigned BarrettReducer::reduce(const Unsigned& n) const
+{
+	if (n < modulus) {
+		return n;
+	}
+	if (n.mostSignificantDigitPosition() > 2 * modulusLength) {
+		return n % modulus;
+	}
+	// The quotient estimate is at most 2 less than the quotient, and the remainder is calculated modulo b^(k+1).
+	Unsigned quotient = highDigits(highDigits(n, modulusLength - 1) * reciprocal, modulusLength + 1);
+	Unsigned remainder = lowDigits(n, modulusLength + 1);
+	Unsigned subtrahend = lowDigits(quotient * modulus, modulusLength + 1);
+	if (remainder < subtrahend) {
+		remainder.digits.resize(modulusLength + 2);
+		remainder.digits.back() = 1;
+	}
+	remainder -= subtrahend;
+	while (remainder >= modulus) {
+		remainder -= modulus;
+	}
+	return remainder.trim();
+}
+
+Unsigned BarrettReducer::multiply(const Unsigned& lhs, const Unsigned& rhs) const
+{
+	return reduce(lhs * rhs);
+}
+
+Unsigned BarrettReducer::pow(const Unsigned& base, const Unsigned& exponent) const
+{
+	return multiPow({base}, {exponent});
+}
+
+Unsigned BarrettReducer::multiPow(const std::vector<Unsigned>& bases, const std::vector<Unsigned>& exponents) const
+{
+	if (bases.size() != exponents.size()) {
+		throw SizeMismatch("BarrettReducer::multiPow(const std::vector<Unsigned>&, const std::vector<Unsigned>&): sizes differ!");
+	}
+	std::vector<Unsigned> reducedBases;
+	reducedBases.reserve(bases.size());
+	for (const Unsigned& base : bases) {
+		reducedBases.push_back(reduce(base));
+	}
+	return slidingWindowMultiPow(
+		std::move(reducedBases),
+		exponents.data(),
+		reduce(Unsigned(1)),
+		[this](Unsigned& n) { n = reduce(square(n)); },
+		[this](Unsigned& n, const Unsigned& m) { n = reduce(n * m); });
+}
+
+Unsigned BarrettReducer::nonZeroModulus(const Unsigned& modulus)
+{
+	if (modulus.isZero()) {
+		throw DivisionByZero("BarrettReducer::BarrettReducer(const Unsigned&): modulus is zero!");
+	}
+	return Unsigned(modulus).trim();
+}
+
+Unsigned BarrettReducer::lowDigits(const Unsigned& n, std::size_t numberOfDigits)
+{
+	Unsigned result;
+	result.digits.assign(n.digits.begin(), n.digits.begin() + std::min(numberOfDigits, n.digits.size()));
+	return result.trim();
+}
+
+Unsigned BarrettReducer::highDigits(const Unsigned& n, std::size_t position)
+{
+	Unsigned result;
+	if (position < n.digits.size()) {
+		result.digits.assign(n.digits.begin() + position, n.digits.end());
+	}
+	return result.trim();
+}
+
+} // namespace MultiPrecision
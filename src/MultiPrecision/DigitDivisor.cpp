@@ -0,0 +1,45 @@
+//
+// Copyright (C) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#include "MultiPrecision/DigitDivisor.h"
+#include "MultiPrecision/DivisionByZero.h"
+
+namespace MultiPrecision {
+
+DigitDivisor::DigitDivisor(DigitType divisor) :
+	divisor(nonZeroDivisor(divisor)),
+	shift(countLeadingZeros(divisor)),
+	normalizedDivisor(divisor << shift),
+	reciprocal(
+		((DigitPairType(~normalizedDivisor) << std::numeric_limits<DigitType>::digits) | std::numeric_limits<DigitType>::max()) /
+		normalizedDivisor)
+{
+}
+
+DigitDivisor::DigitType DigitDivisor::getDivisor() const noexcept
+{
+	return divisor;
+}
+
+DigitDivisor::DigitType DigitDivisor::nonZeroDivisor(DigitType divisor)
+{
+	if (!divisor) {
+		throw DivisionByZero("DigitDivisor::DigitDivisor(DigitType): divisor is zero!");
+	}
+	return divisor;
+}
+
+int DigitDivisor::countLeadingZeros(DigitType divisor) noexcept
+{
+	int count = 0;
+	for (auto mask = DigitType(1) << (std::numeric_limits<DigitType>::digits - 1); mask && (divisor & mask) == 0; mask >>= 1) {
+		++count;
+	}
+	return count;
+}
+
+} // namespace MultiPrecision
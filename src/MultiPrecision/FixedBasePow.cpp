@@ -0,0 +1,117 @@
+//
+// Copyright (C) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#include "MultiPrecision/FixedBasePow.h"
+#include "MultiPrecision/DivisionByZero.h"
+#include "MultiPrecision/Overflow.h"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <utility>
+
+namespace MultiPrecision {
+
+namespace {
+
+// Value of the window of windowSize bits starting at bitPosition of n.
+std::size_t windowValueOf(const Unsigned& n, std::size_t bitPosition, std::size_t windowSize) noexcept
+{
+	using DigitType = Unsigned::DigitType;
+	const DigitType* digits = n.digitData();
+	std::size_t digitPosition = bitPosition / std::numeric_limits<DigitType>::digits;
+	std::size_t bitShift = bitPosition % std::numeric_limits<DigitType>::digits;
+	DigitType value = digits[digitPosition] >> bitShift;
+	if (bitShift + windowSize > std::numeric_limits<DigitType>::digits && digitPosition + 1 < n.numberOfDigits()) {
+		value |= digits[digitPosition + 1] << (std::numeric_limits<DigitType>::digits - bitShift);
+	}
+	return value & ((DigitType(1) << windowSize) - 1);
+}
+
+} // namespace
+
+FixedBasePow::FixedBasePow(const Unsigned& base, const Unsigned& modulus, std::size_t maxExponentBits) :
+	maxExponentBits(maxExponentBits),
+	windowSize(windowSizeOf(maxExponentBits))
+{
+	if (modulus.isZero()) {
+		throw DivisionByZero("FixedBasePow::FixedBasePow(const Unsigned&, const Unsigned&, std::size_t): modulus is zero!");
+	}
+	if (modulus.isOdd() && modulus != Unsigned(1)) {
+		montgomeryContext.emplace(modulus);
+		one = montgomeryContext->toMontgomery(Unsigned(1));
+		powers.push_back(montgomeryContext->toMontgomery(base));
+	} else {
+		barrettReducer.emplace(modulus);
+		one = barrettReducer->reduce(Unsigned(1));
+		powers.push_back(barrettReducer->reduce(base));
+	}
+	std::size_t numberOfWindows = (maxExponentBits + windowSize - 1) / windowSize;
+	powers.reserve(numberOfWindows);
+	while (powers.size() < numberOfWindows) {
+		Unsigned power = powers.back();
+		for (std::size_t i = 0; i < windowSize; ++i) {
+			power = multiply(power, power);
+		}
+		powers.push_back(std::move(power));
+	}
+}
+
+const Unsigned& FixedBasePow::getModulus() const noexcept
+{
+	return montgomeryContext ? montgomeryContext->getModulus() : barrettReducer->getModulus();
+}
+
+Unsigned FixedBasePow::pow(const Unsigned& exponent) const
+{
+	std::size_t bits = exponent.mostSignificantBitPosition();
+	if (bits > maxExponentBits) {
+		throw Overflow("FixedBasePow::pow(const Unsigned&): exponent exceeds maximum bits!");
+	}
+	// Windows by value from the largest down multiply into a running product of the powers of windows of at least that
+	// value, which is multiplied into the result once per value. Multiplications by 1 are skipped.
+	std::size_t numberOfWindows = (bits + windowSize - 1) / windowSize;
+	std::vector<std::pair<std::size_t, std::size_t>> windows;
+	for (std::size_t i = 0; i < numberOfWindows; ++i) {
+		if (std::size_t value = windowValueOf(exponent, i * windowSize, windowSize)) {
+			windows.emplace_back(value, i);
+		}
+	}
+	std::sort(windows.begin(), windows.end(), std::greater<>());
+	Unsigned result = one;
+	Unsigned product;
+	for (auto window = windows.begin(); window != windows.end();) {
+		std::size_t value = window->first;
+		product = window == windows.begin() ? powers[window->second] : multiply(product, powers[window->second]);
+		for (++window; window != windows.end() && window->first == value; ++window) {
+			product = multiply(product, powers[window->second]);
+		}
+		// The product is multiplied into the result once for each value down to the next window's, or to 1.
+		std::size_t nextValue = window != windows.end() ? window->first : 0;
+		for (; value > nextValue; --value) {
+			result = result == one ? product : multiply(result, product);
+		}
+	}
+	return montgomeryContext ? montgomeryContext->fromMontgomery(result) : result;
+}
+
+std::size_t FixedBasePow::windowSizeOf(std::size_t maxExponentBits) noexcept
+{
+	// The window size minimizing the number of windows plus the number of window values.
+	std::size_t windowSize = 1;
+	auto cost = [maxExponentBits](std::size_t w) { return (maxExponentBits + w - 1) / w + (std::size_t(1) << w); };
+	while (windowSize < 16 && cost(windowSize + 1) <= cost(windowSize)) {
+		++windowSize;
+	}
+	return windowSize;
+}
+
+Unsigned FixedBasePow::multiply(const Unsigned& lhs, const Unsigned& rhs) const
+{
+	return montgomeryContext ? montgomeryContext->multiply(lhs, rhs) : barrettReducer->multiply(lhs, rhs);
+}
+
+} // namespace MultiPrecision
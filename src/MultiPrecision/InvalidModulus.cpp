@@ -0,0 +1,20 @@
+//
+// Copyright (C) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#include "MultiPrecision/InvalidModulus.h"
+
+namespace MultiPrecision {
+
+InvalidModulus::InvalidModulus(const std::string what) : Error(what)
+{
+}
+
+InvalidModulus::~InvalidModulus()
+{
+}
+
+} // namespace MultiPrecision
@@ -0,0 +1,59 @@
+//
+// Copyright (C) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#include "MultiPrecision/LimbAllocator.h"
+#include <new>
+
+namespace MultiPrecision {
+
+namespace {
+
+class HeapLimbAllocator : public LimbAllocator
+{
+public:
+	virtual void* allocate(std::size_t bytes) override
+	{
+		return ::operator new(bytes);
+	}
+
+	virtual void deallocate(void* storage, std::size_t) noexcept override
+	{
+		::operator delete(storage);
+	}
+};
+
+HeapLimbAllocator heapLimbAllocator;
+
+thread_local LimbAllocator* currentLimbAllocator = &heapLimbAllocator;
+
+} // namespace
+
+LimbAllocator::~LimbAllocator()
+{
+}
+
+LimbAllocator& LimbAllocator::current() noexcept
+{
+	return *currentLimbAllocator;
+}
+
+LimbAllocator& LimbAllocator::heap() noexcept
+{
+	return heapLimbAllocator;
+}
+
+LimbAllocator::Scope::Scope(LimbAllocator& allocator) noexcept : previous(currentLimbAllocator)
+{
+	currentLimbAllocator = &allocator;
+}
+
+LimbAllocator::Scope::~Scope()
+{
+	currentLimbAllocator = previous;
+}
+
+} // namespace MultiPrecision
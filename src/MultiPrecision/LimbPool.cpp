@@ -0,0 +1,93 @@
+//
+// Copyright (C) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#include "MultiPrecision/LimbPool.h"
+#include <algorithm>
+#include <iterator>
+#include <new>
+
+namespace MultiPrecision {
+
+struct LimbPool::FreeBlock
+{
+	FreeBlock* next;
+};
+
+LimbPool::LimbPool() : slabCursor(nullptr), slabRemaining(0)
+{
+	std::fill(std::begin(freeBlocks), std::end(freeBlocks), nullptr);
+}
+
+LimbPool::~LimbPool()
+{
+	reset();
+}
+
+void* LimbPool::allocate(std::size_t bytes)
+{
+	std::size_t sizeClass = LimbPool::sizeClass(bytes);
+	if (sizeClass > MAX_BLOCK_SIZE_LOG2) {
+		return ::operator new(bytes);
+	}
+	FreeBlock*& freeBlock = freeBlocks[sizeClass - MIN_BLOCK_SIZE_LOG2];
+	if (freeBlock) {
+		void* storage = freeBlock;
+		freeBlock = freeBlock->next;
+		return storage;
+	}
+	std::size_t blockSize = std::size_t(1) << sizeClass;
+	if (slabRemaining < blockSize) {
+		// The rest of the current slab is abandoned until reset, as all block sizes divide the slab size.
+		slabs.reserve(slabs.size() + 1);
+		slabCursor = static_cast<char*>(::operator new(SLAB_SIZE));
+		slabs.push_back(slabCursor);
+		slabRemaining = SLAB_SIZE;
+	}
+	void* storage = slabCursor;
+	slabCursor += blockSize;
+	slabRemaining -= blockSize;
+	return storage;
+}
+
+void LimbPool::deallocate(void* storage, std::size_t bytes) noexcept
+{
+	std::size_t sizeClass = LimbPool::sizeClass(bytes);
+	if (sizeClass > MAX_BLOCK_SIZE_LOG2) {
+		::operator delete(storage);
+	} else {
+		FreeBlock*& freeBlock = freeBlocks[sizeClass - MIN_BLOCK_SIZE_LOG2];
+		freeBlock = new (storage) FreeBlock{freeBlock};
+	}
+}
+
+void LimbPool::reset() noexcept
+{
+	for (void* slab : slabs) {
+		::operator delete(slab);
+	}
+	slabs.clear();
+	slabCursor = nullptr;
+	slabRemaining = 0;
+	std::fill(std::begin(freeBlocks), std::end(freeBlocks), nullptr);
+}
+
+LimbPool& LimbPool::threadLocal()
+{
+	thread_local LimbPool pool;
+	return pool;
+}
+
+std::size_t LimbPool::sizeClass(std::size_t bytes) noexcept
+{
+	std::size_t sizeClass = MIN_BLOCK_SIZE_LOG2;
+	while (sizeClass <= MAX_BLOCK_SIZE_LOG2 && (std::size_t(1) << sizeClass) < bytes) {
+		++sizeClass;
+	}
+	return sizeClass;
+}
+
+} // namespace MultiPrecision
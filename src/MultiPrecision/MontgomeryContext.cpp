@@ -0,0 +1,163 @@
+//
+// Copyright (C) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#include "MultiPrecision/MontgomeryContext.h"
+#include "MultiPrecision/DigitPairType.h"
+#include "MultiPrecision/InvalidModulus.h"
+#include "MultiPrecision/SizeMismatch.h"
+#include "MultiPrecision/SlidingWindowExponentiation.h"
+#include <limits>
+#include <utility>
+
+namespace MultiPrecision {
+
+namespace {
+
+Unsigned::DigitType calculateNegatedInverse(Unsigned::DigitType n)
+{
+	// Newton iteration, doubling the number of correct low order bits, starting with 3 bits correct for odd numbers.
+	Unsigned::DigitType inverse = n;
+	for (int bits = 3; bits < std::numeric_limits<Unsigned::DigitType>::digits; bits *= 2) {
+		inverse *= 2 - n * inverse;
+	}
+	return -inverse;
+}
+
+} // namespace
+
+MontgomeryContext::MontgomeryContext(const Unsigned& modulus) :
+	modulus(oddModulus(modulus)),
+	modulusLength(this->modulus.numberOfDigits()),
+	negatedInverse(calculateNegatedInverse(this->modulus.digits.front())),
+	rSquared((Unsigned(1) << (2 * modulusLength * std::numeric_limits<DigitType>::digits)) % this->modulus),
+	one((Unsigned(1) << (modulusLength * std::numeric_limits<DigitType>::digits)) % this->modulus)
+{
+}
+
+const Unsigned& MontgomeryContext::getModulus() const noexcept
+{
+	return modulus;
+}
+
+Unsigned MontgomeryContext::toMontgomery(const Unsigned& n) const
+{
+	Unsigned residue = n < modulus ? n : n % modulus;
+	Unsigned product;
+	multiply(residue.resize(modulusLength), Unsigned(rSquared).resize(modulusLength), product);
+	return product.trim();
+}
+
+Unsigned MontgomeryContext::fromMontgomery(const Unsigned& n) const
+{
+	Unsigned product;
+	multiply(Unsigned(n).resize(modulusLength), Unsigned(1).resize(modulusLength), product);
+	return product.trim();
+}
+
+Unsigned MontgomeryContext::multiply(const Unsigned& lhs, const Unsigned& rhs) const
+{
+	Unsigned product;
+	multiply(Unsigned(lhs).resize(modulusLength), Unsigned(rhs).resize(modulusLength), product);
+	return product.trim();
+}
+
+Unsigned MontgomeryContext::pow(const Unsigned& base, const Unsigned& exponent) const
+{
+	return multiPow({base}, {exponent});
+}
+
+Unsigned MontgomeryContext::multiPow(const std::vector<Unsigned>& bases, const std::vector<Unsigned>& exponents) const
+{
+	if (bases.size() != exponents.size()) {
+		throw SizeMismatch(
+			"MontgomeryContext::multiPow(const std::vector<Unsigned>&, const std::vector<Unsigned>&): sizes differ!");
+	}
+	std::vector<Unsigned> montgomeryBases;
+	montgomeryBases.reserve(bases.size());
+	for (const Unsigned& base : bases) {
+		montgomeryBases.push_back(toMontgomery(base).resize(modulusLength));
+	}
+	Unsigned product;
+	auto square = [this, &product](Unsigned& n) {
+		multiply(n, n, product);
+		std::swap(n, product);
+	};
+	auto multiplyBy = [this, &product](Unsigned& n, const Unsigned& m) {
+		multiply(n, m, product);
+		std::swap(n, product);
+	};
+	Unsigned power = slidingWindowMultiPow(
+		std::move(montgomeryBases), exponents.data(), Unsigned(one).resize(modulusLength), square, multiplyBy);
+	multiply(power, Unsigned(1).resize(modulusLength), product);
+	return product.trim();
+}
+
+Unsigned MontgomeryContext::oddModulus(const Unsigned& modulus)
+{
+	if (modulus.isZero() || (modulus.digits.front() & 1) == 0) {
+		throw InvalidModulus("MontgomeryContext::MontgomeryContext(const Unsigned&): modulus is not odd!");
+	}
+	return Unsigned(modulus).trim();
+}
+
+/// Coarsely integrated operand scanning, interleaving the multiplication by each digit of rhs with the reduction by one
+/// digit. See Çetin Kaya Koç, Tolga Acar, Burton S. Kaliski Jr., "Analyzing and Comparing Montgomery Multiplication
+/// Algorithms", IEEE Micro 16 (1996), pp 26-33. Operands have exactly as many digits as the modulus, and must not be
+/// product itself.
+void MontgomeryContext::multiply(const Unsigned& lhs, const Unsigned& rhs, Unsigned& product) const
+{
+	const DigitType* a = lhs.digits.data();
+	const DigitType* b = rhs.digits.data();
+	const DigitType* n = modulus.digits.data();
+	const std::size_t s = modulusLength;
+	product.digits.assign(s + 2, 0);
+	DigitType* t = product.digits.data();
+	for (std::size_t i = 0; i < s; ++i) {
+		DigitType carry = 0;
+		for (std::size_t j = 0; j < s; ++j) {
+			DigitPairType tmp = DigitPairType(a[j]) * b[i] + t[j] + carry;
+			t[j] = tmp & std::numeric_limits<DigitType>::max();
+			carry = tmp >> std::numeric_limits<DigitType>::digits;
+		}
+		DigitPairType tmp = DigitPairType(t[s]) + carry;
+		t[s] = tmp & std::numeric_limits<DigitType>::max();
+		t[s + 1] = tmp >> std::numeric_limits<DigitType>::digits;
+		// Add the multiple of the modulus clearing the least significant digit, and shift it out.
+		DigitType m = t[0] * negatedInverse;
+		carry = (DigitPairType(m) * n[0] + t[0]) >> std::numeric_limits<DigitType>::digits;
+		for (std::size_t j = 1; j < s; ++j) {
+			tmp = DigitPairType(m) * n[j] + t[j] + carry;
+			t[j - 1] = tmp & std::numeric_limits<DigitType>::max();
+			carry = tmp >> std::numeric_limits<DigitType>::digits;
+		}
+		tmp = DigitPairType(t[s]) + carry;
+		t[s - 1] = tmp & std::numeric_limits<DigitType>::max();
+		t[s] = t[s + 1] + (tmp >> std::numeric_limits<DigitType>::digits);
+	}
+	// The result is less than 2 N, so at most one subtraction of N remains.
+	bool notLess = t[s] != 0;
+	if (!notLess) {
+		notLess = true;
+		for (std::size_t j = s; j-- > 0;) {
+			if (t[j] != n[j]) {
+				notLess = t[j] > n[j];
+				break;
+			}
+		}
+	}
+	if (notLess) {
+		DigitType borrow = 0;
+		for (std::size_t j = 0; j < s; ++j) {
+			DigitPairType tmp = DigitPairType(t[j]) - n[j] - borrow;
+			t[j] = tmp & std::numeric_limits<DigitType>::max();
+			borrow = (tmp >> std::numeric_limits<DigitType>::digits) & 1;
+		}
+	}
+	product.digits.resize(s);
+}
+
+} // namespace MultiPrecision
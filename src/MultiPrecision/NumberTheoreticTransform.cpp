@@ -0,0 +1,234 @@
+//
+// Copyright (C) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#include "MultiPrecision/NumberTheoreticTransform.h"
+#include <algorithm>
+#include <limits>
+
+namespace MultiPrecision {
+
+namespace {
+
+/// Arithmetic modulo a prime below 2^31, using Montgomery's representation x * R mod prime with R = 2^32, and number
+/// theoretic transforms of lengths dividing prime - 1.
+class PrimeField
+{
+public:
+	PrimeField(std::uint32_t prime, std::uint32_t generator) :
+		prime(prime),
+		generator(generator),
+		negatedInverse(calculateNegatedInverse(prime)),
+		rSquared(((std::uint64_t(1) << 32) % prime) * ((std::uint64_t(1) << 32) % prime) % prime)
+	{
+	}
+
+	std::vector<std::uint32_t> transformed(const std::vector<std::uint32_t>& chunks, std::size_t transformLength) const
+	{
+		std::vector<std::uint32_t> values(transformLength);
+		for (std::size_t i = 0; i < chunks.size(); ++i) {
+			values[i] = multiply(chunks[i], rSquared);
+		}
+		transform(values);
+		return values;
+	}
+
+	void multiplyPointwise(std::vector<std::uint32_t>& values, const std::vector<std::uint32_t>& factors) const
+	{
+		for (std::size_t i = 0; i < values.size(); ++i) {
+			values[i] = multiply(values[i], factors[i]);
+		}
+	}
+
+	// Inverse transform, converting back from Montgomery representation.
+	void transformBack(std::vector<std::uint32_t>& values) const
+	{
+		inverseTransform(values);
+		// Multiplying by plain 1 / length also removes the factor R.
+		std::uint32_t inverseLength = prime - (prime - 1) / values.size();
+		for (std::uint32_t& value : values) {
+			value = multiply(value, inverseLength);
+		}
+	}
+
+private:
+	static std::uint32_t calculateNegatedInverse(std::uint32_t prime)
+	{
+		// Newton iteration, doubling the number of correct low order bits, starting with 3 bits correct for odd numbers.
+		std::uint32_t inverse = prime;
+		for (int i = 0; i < 4; ++i) {
+			inverse *= 2 - prime * inverse;
+		}
+		return -inverse;
+	}
+
+	std::uint32_t reduce(std::uint64_t value) const
+	{
+		std::uint32_t factor = std::uint32_t(value) * negatedInverse;
+		std::uint32_t result = (value + std::uint64_t(factor) * prime) >> 32;
+		return result >= prime ? result - prime : result;
+	}
+
+	std::uint32_t multiply(std::uint32_t lhs, std::uint32_t rhs) const
+	{
+		return reduce(std::uint64_t(lhs) * rhs);
+	}
+
+	std::uint32_t add(std::uint32_t lhs, std::uint32_t rhs) const
+	{
+		std::uint32_t result = lhs + rhs;
+		return result >= prime ? result - prime : result;
+	}
+
+	std::uint32_t subtract(std::uint32_t lhs, std::uint32_t rhs) const
+	{
+		return lhs >= rhs ? lhs - rhs : lhs + prime - rhs;
+	}
+
+	std::uint32_t power(std::uint32_t base, std::uint32_t exponent) const
+	{
+		std::uint32_t result = reduce(rSquared);
+		for (; exponent; exponent >>= 1) {
+			if (exponent & 1) {
+				result = multiply(result, base);
+			}
+			base = multiply(base, base);
+		}
+		return result;
+	}
+
+	// Powers of a root of unity of order length, for the butterflies of all stages.
+	std::vector<std::uint32_t> rootsOfUnity(std::size_t length, bool inverse) const
+	{
+		std::uint32_t root = power(multiply(generator, rSquared), (prime - 1) / length);
+		if (inverse) {
+			root = power(root, length - 1);
+		}
+		std::vector<std::uint32_t> roots(std::max(length / 2, std::size_t(1)));
+		roots[0] = reduce(rSquared);
+		for (std::size_t j = 1; j < roots.size(); ++j) {
+			roots[j] = multiply(roots[j - 1], root);
+		}
+		return roots;
+	}
+
+	// Decimation in frequency, leaving the transform in bit reversed order.
+	void transform(std::vector<std::uint32_t>& values) const
+	{
+		std::size_t length = values.size();
+		std::vector<std::uint32_t> roots = rootsOfUnity(length, false);
+		for (std::size_t half = length / 2, stride = 1; half; half /= 2, stride *= 2) {
+			for (std::size_t start = 0; start < length; start += 2 * half) {
+				for (std::size_t j = 0; j < half; ++j) {
+					std::uint32_t u = values[start + j];
+					std::uint32_t v = values[start + j + half];
+					values[start + j] = add(u, v);
+					values[start + j + half] = multiply(subtract(u, v), roots[j * stride]);
+				}
+			}
+		}
+	}
+
+	// Decimation in time, taking the transform in bit reversed order.
+	void inverseTransform(std::vector<std::uint32_t>& values) const
+	{
+		std::size_t length = values.size();
+		std::vector<std::uint32_t> roots = rootsOfUnity(length, true);
+		for (std::size_t half = 1, stride = length / 2; half < length; half *= 2, stride /= 2) {
+			for (std::size_t start = 0; start < length; start += 2 * half) {
+				for (std::size_t j = 0; j < half; ++j) {
+					std::uint32_t u = values[start + j];
+					std::uint32_t v = multiply(values[start + j + half], roots[j * stride]);
+					values[start + j] = add(u, v);
+					values[start + j + half] = subtract(u, v);
+				}
+			}
+		}
+	}
+
+	const std::uint32_t prime;
+	const std::uint32_t generator;
+	const std::uint32_t negatedInverse;
+	const std::uint32_t rSquared;
+};
+
+// Primes 7 * 2^26 + 1, 27 * 2^26 + 1 and 15 * 2^27 + 1 with their smallest primitive roots.
+const std::uint32_t PRIMES[3] = {469762049, 1811939329, 2013265921};
+const std::uint32_t GENERATORS[3] = {3, 13, 31};
+
+std::uint64_t powerModulo(std::uint64_t base, std::uint64_t exponent, std::uint64_t modulus)
+{
+	std::uint64_t result = 1;
+	for (base %= modulus; exponent; exponent >>= 1) {
+		if (exponent & 1) {
+			result = result * base % modulus;
+		}
+		base = base * base % modulus;
+	}
+	return result;
+}
+
+/// Garner's method from Donald E. Knuth, "The Art of Computer Programming", 2nd vol, 3rd ed, pp 290, combining residues
+/// r0, r1, r2 to x0 + x1 p0 + x2 p0 p1, accumulated in 32 bit chunks.
+std::vector<NumberTheoreticTransform::ChunkType> recombine(
+	const std::vector<std::uint32_t> (&residues)[3],
+	std::size_t productLength)
+{
+	const std::uint64_t p0 = PRIMES[0];
+	const std::uint64_t p1 = PRIMES[1];
+	const std::uint64_t p2 = PRIMES[2];
+	const std::uint64_t p0p1 = p0 * p1;
+	const std::uint64_t inverseP0ModP1 = powerModulo(p0, p1 - 2, p1);
+	const std::uint64_t inverseP0P1ModP2 = powerModulo(p0p1 % p2, p2 - 2, p2);
+	const std::uint64_t mask = std::numeric_limits<std::uint32_t>::max();
+	std::vector<std::uint64_t> sums(productLength + 2);
+	for (std::size_t k = 0; k < productLength; ++k) {
+		std::uint64_t x0 = residues[0][k];
+		std::uint64_t x1 = (residues[1][k] + p1 - x0 % p1) % p1 * inverseP0ModP1 % p1;
+		std::uint64_t low = x0 + x1 * p0;
+		std::uint64_t x2 = (residues[2][k] + p2 - low % p2) % p2 * inverseP0P1ModP2 % p2;
+		std::uint64_t highLow = x2 * (p0p1 & mask);
+		std::uint64_t highHigh = x2 * (p0p1 >> 32);
+		sums[k] += (low & mask) + (highLow & mask);
+		sums[k + 1] += (low >> 32) + (highLow >> 32) + (highHigh & mask);
+		sums[k + 2] += highHigh >> 32;
+	}
+	std::vector<NumberTheoreticTransform::ChunkType> product(productLength);
+	std::uint64_t carry = 0;
+	for (std::size_t k = 0; k < productLength; ++k) {
+		std::uint64_t tmp = sums[k] + carry;
+		product[k] = tmp & mask;
+		carry = tmp >> 32;
+	}
+	return product;
+}
+
+} // namespace
+
+std::vector<NumberTheoreticTransform::ChunkType> NumberTheoreticTransform::multiply(
+	const std::vector<ChunkType>& multiplicand,
+	const std::vector<ChunkType>& multiplier)
+{
+	std::size_t productLength = multiplicand.size() + multiplier.size();
+	std::size_t transformLength = 1;
+	while (transformLength < productLength) {
+		transformLength *= 2;
+	}
+	std::vector<std::uint32_t> residues[3];
+	for (std::size_t k = 0; k < 3; ++k) {
+		PrimeField field(PRIMES[k], GENERATORS[k]);
+		residues[k] = field.transformed(multiplicand, transformLength);
+		if (&multiplicand == &multiplier) {
+			field.multiplyPointwise(residues[k], residues[k]);
+		} else {
+			field.multiplyPointwise(residues[k], field.transformed(multiplier, transformLength));
+		}
+		field.transformBack(residues[k]);
+	}
+	return recombine(residues, productLength);
+}
+
+} // namespace MultiPrecision
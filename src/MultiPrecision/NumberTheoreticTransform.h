@@ -0,0 +1,33 @@
+//
+// Copyright (C) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#ifndef MultiPrecision_NumberTheoreticTransform_INCLUDED
+#define MultiPrecision_NumberTheoreticTransform_INCLUDED
+
+#include <cstdint>
+#include <vector>
+
+namespace MultiPrecision {
+
+/// Multiplication of numbers given as little endian sequences of 32 bit chunks by convolution, calculated by number
+/// theoretic transforms modulo three primes and recombined by the Chinese remainder theorem. Passing the same sequence
+/// as both multiplicand and multiplier saves its second transform when squaring.
+class NumberTheoreticTransform
+{
+public:
+	using ChunkType = std::uint32_t;
+
+	// Maximum number of chunks of the product, limited by the largest power of 2 dividing all primes minus 1, and by the
+	// product of primes exceeding the maximum convolution sum.
+	static constexpr std::size_t MAX_PRODUCT_LENGTH = std::size_t(1) << 26;
+
+	static std::vector<ChunkType> multiply(const std::vector<ChunkType>& multiplicand, const std::vector<ChunkType>& multiplier);
+};
+
+} // namespace MultiPrecision
+
+#endif // MultiPrecision_NumberTheoreticTransform_INCLUDED
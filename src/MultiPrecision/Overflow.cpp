@@ -0,0 +1,20 @@
+//
+// Copyright (C) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#include "MultiPrecision/Overflow.h"
+
+namespace MultiPrecision {
+
+Overflow::Overflow(const std::string what) : Error(what)
+{
+}
+
+Overflow::~Overflow()
+{
+}
+
+} // namespace MultiPrecision
@@ -0,0 +1,207 @@
+//
+// Copyright (C) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#include "MultiPrecision/PseudoMersenneModulus.h"
+#include "MultiPrecision/DigitPairType.h"
+#include "MultiPrecision/InvalidModulus.h"
+#include "MultiPrecision/SizeMismatch.h"
+#include "MultiPrecision/SlidingWindowExponentiation.h"
+#include "MultiPrecision/math.h"
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace MultiPrecision {
+
+PseudoMersenneModulus::PseudoMersenneModulus(std::size_t k, const Unsigned& c) :
+	k(k),
+	c(Unsigned(c).trim()),
+	modulus(modulusOf(k, this->c))
+{
+}
+
+PseudoMersenneModulus::PseudoMersenneModulus(const Unsigned& modulus) :
+	PseudoMersenneModulus(modulus.mostSignificantBitPosition(), cOf(modulus))
+{
+}
+
+bool PseudoMersenneModulus::isApplicable(const Unsigned& modulus)
+{
+	std::size_t k = modulus.mostSignificantBitPosition();
+	std::size_t cBits = cOf(modulus).mostSignificantBitPosition();
+	return k > 1 && 2 * cBits <= k && (cBits <= std::numeric_limits<DigitType>::digits || 4 * cBits <= k);
+}
+
+const Unsigned& PseudoMersenneModulus::getModulus() const noexcept
+{
+	return modulus;
+}
+
+Unsigned PseudoMersenneModulus::reduce(const Unsigned& n) const
+{
+	Unsigned remainder(n);
+	reduceInPlace(remainder);
+	return remainder;
+}
+
+Unsigned PseudoMersenneModulus::multiply(const Unsigned& lhs, const Unsigned& rhs) const
+{
+	Unsigned product;
+	multiply(lhs, rhs, product);
+	return product;
+}
+
+Unsigned PseudoMersenneModulus::pow(const Unsigned& base, const Unsigned& exponent) const
+{
+	return multiPow({base}, {exponent});
+}
+
+Unsigned PseudoMersenneModulus::multiPow(const std::vector<Unsigned>& bases, const std::vector<Unsigned>& exponents) const
+{
+	if (bases.size() != exponents.size()) {
+		throw SizeMismatch(
+			"PseudoMersenneModulus::multiPow(const std::vector<Unsigned>&, const std::vector<Unsigned>&): sizes differ!");
+	}
+	std::vector<Unsigned> reducedBases;
+	reducedBases.reserve(bases.size());
+	for (const Unsigned& base : bases) {
+		reducedBases.push_back(reduce(base));
+	}
+	Unsigned product;
+	return slidingWindowMultiPow(
+		std::move(reducedBases),
+		exponents.data(),
+		reduce(Unsigned(1)),
+		[this, &product](Unsigned& n) {
+			multiply(n, n, product);
+			std::swap(n, product);
+		},
+		[this, &product](Unsigned& n, const Unsigned& m) {
+			multiply(n, m, product);
+			std::swap(n, product);
+		});
+}
+
+Unsigned PseudoMersenneModulus::cOf(const Unsigned& modulus)
+{
+	return (Unsigned(1) << modulus.mostSignificantBitPosition()) - modulus;
+}
+
+Unsigned PseudoMersenneModulus::modulusOf(std::size_t k, const Unsigned& c)
+{
+	if (c.isZero() || k == 0 || c.mostSignificantBitPosition() > k || c > (Unsigned(1) << (k - 1))) {
+		throw InvalidModulus(
+			"PseudoMersenneModulus::PseudoMersenneModulus(std::size_t, const Unsigned&): c is not in (0, 2^(k - 1)]!");
+	}
+	return (Unsigned(1) << k) - c;
+}
+
+/// Operands of few digits are multiplied by schoolbook multiplication reusing the digits of product, which must not be an
+/// operand itself.
+void PseudoMersenneModulus::multiply(const Unsigned& lhs, const Unsigned& rhs, Unsigned& product) const
+{
+	const std::size_t lhsLength = lhs.digits.size();
+	const std::size_t rhsLength = rhs.digits.size();
+	if (lhsLength > SCHOOLBOOK_LENGTH || rhsLength > SCHOOLBOOK_LENGTH) {
+		product = lhs * rhs;
+	} else {
+		product.digits.assign(lhsLength + rhsLength, 0);
+		const DigitType* a = lhs.digits.data();
+		const DigitType* b = rhs.digits.data();
+		DigitType* t = product.digits.data();
+		for (std::size_t i = 0; i < rhsLength; ++i) {
+			DigitType carry = 0;
+			for (std::size_t j = 0; j < lhsLength; ++j) {
+				DigitPairType tmp = DigitPairType(a[j]) * b[i] + t[i + j] + carry;
+				t[i + j] = tmp & std::numeric_limits<DigitType>::max();
+				carry = tmp >> std::numeric_limits<DigitType>::digits;
+			}
+			t[i + lhsLength] = carry;
+		}
+	}
+	reduceInPlace(product);
+}
+
+void PseudoMersenneModulus::reduceInPlace(Unsigned& n) const
+{
+	constexpr std::size_t bits = std::numeric_limits<DigitType>::digits;
+	const std::size_t q = k / bits;
+	const std::size_t r = k % bits;
+	const DigitType lowMask = (DigitType(1) << r) - 1;
+	// Whether n >= 2^k, by any bits set from position k on.
+	auto exceedsLowBits = [&n, q, r]() {
+		for (std::size_t i = n.digits.size(); i-- > q + 1;) {
+			if (n.digits[i]) {
+				return true;
+			}
+		}
+		return q < n.digits.size() && (n.digits[q] >> r) != 0;
+	};
+	while (exceedsLowBits()) {
+		if (c.digits.size() == 1) {
+			// Fold in place, reading the digits of h from behind those of the sum written, and the digits of l in place. A
+			// zero digit on top saves testing for the end of h, and double shifts of h digits by r == 0 give zero.
+			const std::size_t highLength = n.digits.size() - q;
+			const std::size_t sumLength = std::max(q + 1, highLength);
+			n.digits.push_back(0);
+			DigitType* t = n.digits.data();
+			const DigitType lowTop = t[q] & lowMask;
+			DigitType carry = 0;
+			for (std::size_t i = 0; i < sumLength; ++i) {
+				DigitType high = i < highLength ? (t[q + i] >> r) | ((t[q + i + 1] << 1) << (bits - 1 - r)) : 0;
+				DigitType low = i < q ? t[i] : i == q ? lowTop : 0;
+				DigitPairType sum = DigitPairType(high) * c.digits.front() + low + carry;
+				t[i] = sum & std::numeric_limits<DigitType>::max();
+				carry = sum >> bits;
+			}
+			n.digits.resize(sumLength);
+			if (carry) {
+				n.digits.push_back(carry);
+			}
+		} else if (c.digits.size() <= q) {
+			// Fold in place likewise, by product scanning. Digit i of h * c sums the products of digits j of h and i - j of
+			// c, for j from i - m + 1 on, reading the digits of n from q + i - m + 1 on, which are behind those of the sum
+			// written for c of m <= q digits. The sum of a column is kept in two digits plus the count of their overflows.
+			const std::size_t m = c.digits.size();
+			const std::size_t highLength = n.digits.size() - q;
+			const std::size_t sumLength = std::max(q + 1, highLength + m);
+			n.digits.push_back(0);
+			DigitType* t = n.digits.data();
+			const DigitType* d = c.digits.data();
+			const DigitType lowTop = t[q] & lowMask;
+			DigitPairType sum = 0;
+			for (std::size_t i = 0; i < sumLength; ++i) {
+				sum += i < q ? t[i] : i == q ? lowTop : 0;
+				DigitType overflows = 0;
+				for (std::size_t j = i < m ? 0 : i - m + 1; j <= i && j < highLength; ++j) {
+					DigitType high = (t[q + j] >> r) | ((t[q + j + 1] << 1) << (bits - 1 - r));
+					DigitPairType product = DigitPairType(high) * d[i - j];
+					sum += product;
+					overflows += sum < product;
+				}
+				t[i] = sum & std::numeric_limits<DigitType>::max();
+				sum = (sum >> bits) | (DigitPairType(overflows) << bits);
+			}
+			n.digits.resize(sumLength);
+			if (sum) {
+				n.digits.push_back(static_cast<DigitType>(sum));
+			}
+		} else {
+			Unsigned high = n >> k;
+			n.digits.resize(q + 1);
+			n.digits.back() &= lowMask;
+			n += high * c;
+		}
+	}
+	n.trim();
+	// As m >= 2^(k - 1), a remainder less than 2^k exceeds m by less than m.
+	if (n >= modulus) {
+		n -= modulus;
+	}
+}
+
+} // namespace MultiPrecision
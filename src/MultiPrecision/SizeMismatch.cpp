@@ -0,0 +1,20 @@
+//
+// Copyright (C) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#include "MultiPrecision/SizeMismatch.h"
+
+namespace MultiPrecision {
+
+SizeMismatch::SizeMismatch(const std::string what) : Error(what)
+{
+}
+
+SizeMismatch::~SizeMismatch()
+{
+}
+
+} // namespace MultiPrecision
@@ -0,0 +1,133 @@
+//
+// Copyright (C) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#ifndef MultiPrecision_SlidingWindowExponentiation_INCLUDED
+#define MultiPrecision_SlidingWindowExponentiation_INCLUDED
+
+#include "MultiPrecision/Unsigned.h"
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace MultiPrecision {
+
+// Window sizes minimizing squarings plus multiplications, including those of the table, by exponent bit length.
+inline std::size_t slidingWindowSizeOf(std::size_t bits) noexcept
+{
+	static constexpr std::size_t WINDOW_THRESHOLDS[] = {7, 25, 81, 241, 673, 1793, 4609};
+	std::size_t windowSize = 1;
+	for (std::size_t threshold : WINDOW_THRESHOLDS) {
+		windowSize += bits > threshold;
+	}
+	return windowSize;
+}
+
+// Windows of up to windowSize bits of exponent, each starting and ending with a 1 bit, as pairs of the position of
+// their least significant bit and their value, most significant first.
+inline std::vector<std::pair<std::size_t, std::size_t>> slidingWindowsOf(const Unsigned& exponent, std::size_t windowSize)
+{
+	using DigitType = Unsigned::DigitType;
+	const DigitType* digits = exponent.digitData();
+	auto bitAt = [digits](std::size_t i) {
+		return (digits[i / std::numeric_limits<DigitType>::digits] >> (i % std::numeric_limits<DigitType>::digits)) & 1;
+	};
+	std::vector<std::pair<std::size_t, std::size_t>> windows;
+	for (std::size_t i = exponent.mostSignificantBitPosition(); i-- > 0;) {
+		if (!bitAt(i)) {
+			continue;
+		}
+		// The window from bit i down to the lowest 1 bit j within reach.
+		std::size_t j = i + 1 > windowSize ? i + 1 - windowSize : 0;
+		while (!bitAt(j)) {
+			++j;
+		}
+		std::size_t value = 0;
+		for (std::size_t l = i + 1; l-- > j;) {
+			value = 2 * value + bitAt(l);
+		}
+		windows.emplace_back(j, value);
+		i = j;
+	}
+	return windows;
+}
+
+/// Product of the powers bases[i]^exponents[i] by interleaved left-to-right sliding windows, scanning each exponent for
+/// windows of up to k bits ending in a 1 bit, and multiplying by the odd power of its base each window selects from a
+/// table calculated in advance. All bases share one chain of squarings, and k is chosen per exponent. The first window
+/// initializes the power, so neither squarings nor multiplications of one occur. Algorithm 14.85 from Alfred J. Menezes,
+/// Paul C. van Oorschot, Scott A. Vanstone, "Handbook of Applied Cryptography", 1996, pp 616, and interleaving from
+/// Bodo Möller, "Algorithms for Multi-exponentiation", Selected Areas in Cryptography 2001, pp 165-180.
+///
+/// Elements are squared in place by square(x) and multiplied in place by multiply(x, y), and one is returned if all
+/// exponents are 0. Exponents are given by pointer to as many as there are bases.
+template<typename Element, typename Square, typename Multiply>
+Element slidingWindowMultiPow(std::vector<Element> bases, const Unsigned* exponents, Element one, Square square, Multiply multiply)
+{
+	std::size_t bits = 0;
+	std::vector<std::vector<std::pair<std::size_t, std::size_t>>> windows;
+	// oddPowers[i][j] == bases[i]^(2j + 1)
+	std::vector<std::vector<Element>> oddPowers(bases.size());
+	for (std::size_t i = 0; i < bases.size(); ++i) {
+		std::size_t exponentBits = exponents[i].mostSignificantBitPosition();
+		bits = std::max(bits, exponentBits);
+		std::size_t windowSize = slidingWindowSizeOf(exponentBits);
+		windows.push_back(slidingWindowsOf(exponents[i], windowSize));
+		// The table up to the largest odd power selected.
+		std::size_t largestValue = 0;
+		for (auto& window : windows.back()) {
+			largestValue = std::max(largestValue, window.second);
+		}
+		if (largestValue == 0) {
+			continue;
+		}
+		oddPowers[i].reserve(largestValue / 2 + 1);
+		oddPowers[i].push_back(std::move(bases[i]));
+		if (largestValue > 1) {
+			Element baseSquared = oddPowers[i].front();
+			square(baseSquared);
+			while (oddPowers[i].size() <= largestValue / 2) {
+				oddPowers[i].push_back(oddPowers[i].back());
+				multiply(oddPowers[i].back(), baseSquared);
+			}
+		}
+	}
+
+	Element power = std::move(one);
+	bool first = true;
+	std::vector<std::size_t> nextWindows(bases.size(), 0);
+	for (std::size_t position = bits; position-- > 0;) {
+		if (!first) {
+			square(power);
+		}
+		for (std::size_t i = 0; i < bases.size(); ++i) {
+			if (nextWindows[i] < windows[i].size() && windows[i][nextWindows[i]].first == position) {
+				const Element& oddPower = oddPowers[i][windows[i][nextWindows[i]++].second / 2];
+				if (first) {
+					power = oddPower;
+					first = false;
+				} else {
+					multiply(power, oddPower);
+				}
+			}
+		}
+	}
+	return power;
+}
+
+/// Power base^exponent by slidingWindowMultiPow of a single base.
+template<typename Element, typename Square, typename Multiply>
+Element slidingWindowPow(Element base, const Unsigned& exponent, Element one, Square square, Multiply multiply)
+{
+	std::vector<Element> bases;
+	bases.push_back(std::move(base));
+	return slidingWindowMultiPow(std::move(bases), &exponent, std::move(one), square, multiply);
+}
+
+} // namespace MultiPrecision
+
+#endif // MultiPrecision_SlidingWindowExponentiation_INCLUDED
@@ -48,7 +48,9 @@ Unsigned::Unsigned(unsigned long long n)
 	while (n) {
 		DigitType digit = n & std::numeric_limits<DigitType>::max();
 		digits.push_back(digit);
-		n >>= std::numeric_limits<DigitType>::digits;
+		// Shift in two steps, as shifting by the full width of n is undefined for digits as wide as n.
+		n >>= std::numeric_limits<DigitType>::digits - 1;
+		n >>= 1;
 	}
 }
 
@@ -88,7 +90,7 @@ void Unsigned::read(std::istream& in, Unsigned& out)
 			in.unget();
 			readDecimal(in, out);
 		} else if (in.get(c)) {
-			if (c != 'x') {
+			if (c != 'x' && c != 'X') {
 				in.unget();
 				readOctal(in, out);
 			} else {
@@ -98,95 +100,6 @@ void Unsigned::read(std::istream& in, Unsigned& out)
 	}
 }
 
-void Unsigned::readDecimal(std::istream& in, Unsigned& out)
-{
-	out.digits.clear();
-	char c;
-	while (in.get(c)) {
-		if (c >= '0' && c <= '9') {
-			out *= 10;
-			out += c - '0';
-		} else {
-			in.unget();
-			break;
-		}
-	}
-}
-
-void Unsigned::readHexadecimal(std::istream& in, Unsigned& out)
-{
-	out.digits.clear();
-	char c;
-	while (in.get(c)) {
-		if (c >= '0' && c <= '9') {
-			out <<= 4;
-			out += c - '0';
-		} else if (c >= 'a' && c <= 'f') {
-			out <<= 4;
-			out += c - 'a' + 10;
-		} else {
-			in.unget();
-			break;
-		}
-	}
-}
-
-void Unsigned::readOctal(std::istream& in, Unsigned& out)
-{
-	out.digits.clear();
-	char c;
-	while (in.get(c)) {
-		if (c >= '0' && c <= '7') {
-			out <<= 3;
-			out += c - '0';
-		} else {
-			in.unget();
-			break;
-		}
-	}
-}
-
-std::string Unsigned::toDecimalString() const
-{
-	std::vector<char> buffer;
-	DivisionResult divisionResult = dividedBy(10);
-	buffer.push_back(divisionResult.remainder.isZero() ? '0' : divisionResult.remainder.digits.front() + '0');
-	while (!divisionResult.quotient.isZero()) {
-		divisionResult = divisionResult.quotient.dividedBy(10);
-		buffer.push_back(divisionResult.remainder.isZero() ? '0' : divisionResult.remainder.digits.front() + '0');
-	}
-	return std::string(buffer.rbegin(), buffer.rend());
-}
-
-std::string Unsigned::toHexadecimalString(bool uppercase) const
-{
-	std::vector<char> buffer;
-	const char a = uppercase ? 'A' : 'a';
-	DigitType remainder = isZero() ? 0 : digits.front() & 0xf;
-	Unsigned quotient = *this >> 4;
-	buffer.push_back(remainder < 10 ? '0' + remainder : a + remainder - 10);
-	while (!quotient.isZero()) {
-		remainder = quotient.isZero() ? 0 : quotient.digits.front() & 0xf;
-		quotient >>= 4;
-		buffer.push_back(remainder < 10 ? '0' + remainder : a + remainder - 10);
-	}
-	return std::string(buffer.rbegin(), buffer.rend());
-}
-
-std::string Unsigned::toOctalString() const
-{
-	std::vector<char> buffer;
-	DigitType remainder = isZero() ? 0 : digits.front() & 0x7;
-	Unsigned quotient = *this >> 3;
-	buffer.push_back('0' + remainder);
-	while (!quotient.isZero()) {
-		remainder = quotient.isZero() ? 0 : quotient.digits.front() & 0x7;
-		quotient >>= 3;
-		buffer.push_back('0' + remainder);
-	}
-	return std::string(buffer.rbegin(), buffer.rend());
-}
-
 bool Unsigned::isZero() const noexcept
 {
 	bool result = true;
@@ -199,6 +112,11 @@ bool Unsigned::isZero() const noexcept
 	return result;
 }
 
+bool Unsigned::isOdd() const noexcept
+{
+	return !digits.empty() && (digits.front() & 1);
+}
+
 Unsigned::MinimalBitRange Unsigned::minimalBitRange() const noexcept
 {
 	return MinimalBitRange(*this);
@@ -228,6 +146,16 @@ std::size_t Unsigned::numberOfDigits() const noexcept
 	return digits.size();
 }
 
+Unsigned::DigitType* Unsigned::digitData() noexcept
+{
+	return digits.data();
+}
+
+const Unsigned::DigitType* Unsigned::digitData() const noexcept
+{
+	return digits.data();
+}
+
 Unsigned& Unsigned::resize(std::size_t numberOfDigits)
 {
 	for (std::size_t i = digits.size(); i-- > numberOfDigits;) {
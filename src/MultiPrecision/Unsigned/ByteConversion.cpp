@@ -0,0 +1,49 @@
+//
+// Copyright (C) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#include "MultiPrecision/Overflow.h"
+#include "MultiPrecision/Unsigned.h"
+#include <limits>
+
+namespace MultiPrecision {
+
+void Unsigned::toBytes(unsigned char* first, std::size_t length, ByteOrder order) const
+{
+	if (numberOfBytes() > length) {
+		throw Overflow("Unsigned::toBytes(unsigned char*, std::size_t, ByteOrder): number exceeds length!");
+	}
+	std::size_t numberLength = digits.size();
+	for (std::size_t i = 0; i < length; ++i) {
+		std::size_t digitPosition = i / sizeof(DigitType);
+		unsigned char byte = 0;
+		if (digitPosition < numberLength) {
+			byte = (digits[digitPosition] >> (i % sizeof(DigitType) * std::numeric_limits<unsigned char>::digits)) &
+				std::numeric_limits<unsigned char>::max();
+		}
+		first[order == ByteOrder::LEAST_SIGNIFICANT_FIRST ? i : length - 1 - i] = byte;
+	}
+}
+
+Unsigned Unsigned::fromBytes(const unsigned char* first, std::size_t length, ByteOrder order)
+{
+	Unsigned result;
+	result.digits.assign((length + sizeof(DigitType) - 1) / sizeof(DigitType), 0);
+	for (std::size_t i = 0; i < length; ++i) {
+		DigitType byte = first[order == ByteOrder::LEAST_SIGNIFICANT_FIRST ? i : length - 1 - i];
+		result.digits[i / sizeof(DigitType)] |= byte << (i % sizeof(DigitType) * std::numeric_limits<unsigned char>::digits);
+	}
+	result.trim();
+	return result;
+}
+
+std::size_t Unsigned::numberOfBytes() const noexcept
+{
+	return (mostSignificantBitPosition() + std::numeric_limits<unsigned char>::digits - 1) /
+		std::numeric_limits<unsigned char>::digits;
+}
+
+} // namespace MultiPrecision
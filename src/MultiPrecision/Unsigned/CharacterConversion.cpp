@@ -0,0 +1,107 @@
+//
+// Copyright (C) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#include "MultiPrecision/Unsigned.h"
+#include "MultiPrecision/math.h"
+#include <algorithm>
+#include <new>
+#include <system_error>
+#include <utility>
+
+namespace MultiPrecision {
+
+namespace {
+
+const char CHARACTERS[] = "0123456789abcdefghijklmnopqrstuv";
+
+// Bits per character of power of 2 bases, and 0 for others.
+std::size_t bitsPerCharacterOf(int base) noexcept
+{
+	switch (base) {
+	case 2:
+		return 1;
+	case 4:
+		return 2;
+	case 8:
+		return 3;
+	case 16:
+		return 4;
+	case 32:
+		return 5;
+	default:
+		return 0;
+	}
+}
+
+// Value of a digit or letter in either case, and a value exceeding all bases for other characters.
+int valueOf(char c) noexcept
+{
+	if (c >= '0' && c <= '9') {
+		return c - '0';
+	} else if (c >= 'a' && c <= 'z') {
+		return c - 'a' + 10;
+	} else if (c >= 'A' && c <= 'Z') {
+		return c - 'A' + 10;
+	} else {
+		return 36;
+	}
+}
+
+} // namespace
+
+std::to_chars_result Unsigned::toChars(char* first, char* last, int base) const noexcept
+{
+	std::size_t available = last - first;
+	try {
+		if (base == 10) {
+			std::size_t length = decimalDigitsUpperBound();
+			if (available < length) {
+				// With log10(2) > 0.30102, a number of b bits has more than (b - 1) * 0.30102 decimal digits, and fits if
+				// less than 10^available.
+				std::size_t bits = mostSignificantBitPosition();
+				if (available == 0 || (bits - 1) * 30102 / 100000 >= available ||
+					*this >= pow(Unsigned(10), Unsigned(available))) {
+					return {last, std::errc::value_too_large};
+				}
+				length = available;
+			}
+			return {formatDecimal(first, length), std::errc()};
+		} else if (std::size_t bitsPerCharacter = bitsPerCharacterOf(base)) {
+			std::size_t length = isZero() ? 1 : (mostSignificantBitPosition() + bitsPerCharacter - 1) / bitsPerCharacter;
+			if (available >= length) {
+				formatPowerOfTwoRadix(first, length, bitsPerCharacter, CHARACTERS);
+				return {first + length, std::errc()};
+			}
+			return {last, std::errc::value_too_large};
+		} else {
+			return {last, std::errc::invalid_argument};
+		}
+	} catch (const std::bad_alloc&) {
+		return {last, std::errc::not_enough_memory};
+	}
+}
+
+std::from_chars_result Unsigned::fromChars(const char* first, const char* last, Unsigned& value, int base) noexcept
+{
+	std::size_t bitsPerCharacter = bitsPerCharacterOf(base);
+	if (base != 10 && !bitsPerCharacter) {
+		return {first, std::errc::invalid_argument};
+	}
+	const char* end = std::find_if(first, last, [base](char c) { return valueOf(c) >= base; });
+	if (end == first) {
+		return {first, std::errc::invalid_argument};
+	}
+	try {
+		Unsigned parsed = bitsPerCharacter ? parsePowerOfTwoRadix(first, end, bitsPerCharacter) : parseDecimal(first, end);
+		value = std::move(parsed);
+	} catch (const std::bad_alloc&) {
+		return {first, std::errc::not_enough_memory};
+	}
+	return {end, std::errc()};
+}
+
+} // namespace MultiPrecision
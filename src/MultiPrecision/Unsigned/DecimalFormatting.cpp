@@ -0,0 +1,139 @@
+//
+// Copyright (C) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#include "MultiPrecision/DigitDivisor.h"
+#include "MultiPrecision/Unsigned.h"
+#include "MultiPrecision/math.h"
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace MultiPrecision {
+
+/// Conversion to decimal digits by divide and conquer, splitting the number by powers 10^(c * 2^k) into halves of equal
+/// numbers of decimal digits, with c the number of decimal digits fitting into one digit. Numbers of few digits are
+/// converted c decimal digits per division by a single digit. The powers are calculated once per conversion, and digits
+/// are written from right to left into a buffer of sufficient length. Algorithm 1.26 from Richard P. Brent, Paul
+/// Zimmermann, "Modern Computer Arithmetic", 2010, pp 43.
+class Unsigned::DecimalFormatting
+{
+public:
+	explicit DecimalFormatting(const Unsigned& number) : number(number), chunkDivisor(getChunkDivisor())
+	{
+		std::size_t numberLength = number.mostSignificantDigitPosition();
+		if (numberLength > FORMATTING_THRESHOLD) {
+			// Up to the first power of more than half the digits of the number.
+			powers.emplace_back(CHUNK_RADIX);
+			while (2 * powers.back().numberOfDigits() - 2 < numberLength) {
+				powers.push_back(square(powers.back()));
+			}
+		}
+	}
+
+	// Write the decimal digits into first up to first + length, of at least as many as there are, and return their end.
+	char* write(char* first, std::size_t length)
+	{
+		char* end = first + length;
+		std::fill(first, end, '0');
+		char* begin = writeDigits(Unsigned(number), end);
+		if (begin == end) {
+			return first + 1;
+		}
+		return begin != first ? std::copy(begin, end, first) : end;
+	}
+
+private:
+	static constexpr std::size_t CHUNK_DIGITS = std::numeric_limits<DigitType>::digits10;
+	static constexpr DigitType CHUNK_RADIX = []() {
+		DigitType radix = 1;
+		for (std::size_t i = 0; i < CHUNK_DIGITS; ++i) {
+			radix *= 10;
+		}
+		return radix;
+	}();
+	// Number length in digits up to which conversion by single digit divisions outperforms divide and conquer.
+	static constexpr std::size_t FORMATTING_THRESHOLD = 30;
+
+	static const DigitDivisor& getChunkDivisor()
+	{
+		static const DigitDivisor chunkDivisor(CHUNK_RADIX);
+		return chunkDivisor;
+	}
+
+	// Write the decimal digits of n without leading zeros ending at end, and return their beginning.
+	char* writeDigits(Unsigned n, char* end)
+	{
+		if (n.mostSignificantDigitPosition() > FORMATTING_THRESHOLD) {
+			std::size_t k = powers.size() - 1;
+			while (k && n < powers[k]) {
+				--k;
+			}
+			Unsigned::DivisionResult result = n.dividedBy(powers[k]);
+			writePaddedDigits(std::move(result.remainder), k, end);
+			return writeDigits(std::move(result.quotient), end - (CHUNK_DIGITS << k));
+		} else {
+			char* begin = end;
+			while (!n.isZero()) {
+				begin = writeChunk(n.divideInPlace(chunkDivisor), end);
+				end -= CHUNK_DIGITS;
+			}
+			return begin;
+		}
+	}
+
+	// Write the decimal digits of n < powers[k], padded with leading zeros to c * 2^k, ending at end.
+	void writePaddedDigits(Unsigned n, std::size_t k, char* end)
+	{
+		if (k && n.mostSignificantDigitPosition() > FORMATTING_THRESHOLD) {
+			Unsigned::DivisionResult result = n.dividedBy(powers[k - 1]);
+			writePaddedDigits(std::move(result.remainder), k - 1, end);
+			writePaddedDigits(std::move(result.quotient), k - 1, end - (CHUNK_DIGITS << (k - 1)));
+		} else {
+			// The buffer is initialized by zeros, so leading zeros need not be written.
+			while (!n.isZero()) {
+				writeChunk(n.divideInPlace(chunkDivisor), end);
+				end -= CHUNK_DIGITS;
+			}
+		}
+	}
+
+	// Write the decimal digits of chunk without leading zeros ending at end, and return their beginning.
+	static char* writeChunk(DigitType chunk, char* end)
+	{
+		do {
+			*--end = '0' + chunk % 10;
+			chunk /= 10;
+		} while (chunk);
+		return end;
+	}
+
+	const Unsigned& number;
+	const DigitDivisor& chunkDivisor;
+	// powers[k] == 10^(c * 2^k)
+	std::vector<Unsigned> powers;
+};
+
+char* Unsigned::formatDecimal(char* first, std::size_t length) const
+{
+	return DecimalFormatting(*this).write(first, length);
+}
+
+std::string Unsigned::toDecimalString() const
+{
+	std::string result(decimalDigitsUpperBound(), '0');
+	result.resize(formatDecimal(&result[0], result.size()) - result.data());
+	return result;
+}
+
+std::size_t Unsigned::decimalDigitsUpperBound() const noexcept
+{
+	// With log10(2) < 0.30103
+	return mostSignificantBitPosition() * 30103 / 100000 + 1;
+}
+
+} // namespace MultiPrecision
@@ -0,0 +1,132 @@
+//
+// Copyright (C) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#include "MultiPrecision/DigitPairType.h"
+#include "MultiPrecision/Unsigned.h"
+#include "MultiPrecision/math.h"
+#include <istream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace MultiPrecision {
+
+/// Conversion from decimal digits by divide and conquer, the inverse of DecimalFormatting. Decimal digits are split into
+/// a lower part of c * 2^k digits and an upper part, with c the number of decimal digits fitting into one digit, and
+/// combined as upper * 10^(c * 2^k) + lower. Short parts are converted c decimal digits per multiply-add of a single
+/// digit in place. The powers are calculated once per conversion.
+class Unsigned::DecimalParsing
+{
+public:
+	DecimalParsing(const char* first, const char* last) : first(first), last(last)
+	{
+		std::size_t numberOfChunks = (last - first + CHUNK_DIGITS - 1) / CHUNK_DIGITS;
+		if (numberOfChunks > PARSING_THRESHOLD) {
+			// Up to the first power of at least half the decimal digits.
+			powers.emplace_back(CHUNK_RADIX);
+			while ((std::size_t(1) << powers.size()) < numberOfChunks) {
+				powers.push_back(square(powers.back()));
+			}
+		}
+	}
+
+	Unsigned toUnsigned() const
+	{
+		return parseDigits(first, last, powers.size());
+	}
+
+private:
+	static constexpr std::size_t CHUNK_DIGITS = std::numeric_limits<DigitType>::digits10;
+	static constexpr DigitType CHUNK_RADIX = []() {
+		DigitType radix = 1;
+		for (std::size_t i = 0; i < CHUNK_DIGITS; ++i) {
+			radix *= 10;
+		}
+		return radix;
+	}();
+	// Number of chunks up to which conversion by single digit multiply-adds outperforms divide and conquer.
+	static constexpr std::size_t PARSING_THRESHOLD = 30;
+
+	// Convert the decimal digits from first to last, splitting them at powers[k - 1] and below.
+	Unsigned parseDigits(const char* first, const char* last, std::size_t k) const
+	{
+		while (k && std::size_t(last - first) <= (CHUNK_DIGITS << (k - 1))) {
+			--k;
+		}
+		if (k && std::size_t(last - first) > PARSING_THRESHOLD * CHUNK_DIGITS) {
+			const char* middle = last - (CHUNK_DIGITS << (k - 1));
+			Unsigned result = parseDigits(first, middle, k - 1) * powers[k - 1];
+			return result += parseDigits(middle, last, k - 1);
+		} else {
+			return parseChunks(first, last);
+		}
+	}
+
+	static Unsigned parseChunks(const char* first, const char* last)
+	{
+		Unsigned result;
+		result.digits.reserve((last - first) / CHUNK_DIGITS + 1);
+		// The first chunk takes the remainder of decimal digits not filling a complete one.
+		const char* next = first + (last - first) % CHUNK_DIGITS;
+		if (next == first && first != last) {
+			next += CHUNK_DIGITS;
+		}
+		while (first != last) {
+			DigitType chunk = 0;
+			DigitType radix = 1;
+			for (; first != next; ++first) {
+				chunk = chunk * 10 + (*first - '0');
+				radix *= 10;
+			}
+			multiplyAndAdd(result, radix, chunk);
+			next += CHUNK_DIGITS;
+		}
+		return result;
+	}
+
+	// n = n * factor + summand
+	static void multiplyAndAdd(Unsigned& n, DigitType factor, DigitType summand)
+	{
+		DigitType carry = summand;
+		for (DigitType& digit : n.digits) {
+			DigitPairType product = DigitPairType(digit) * factor + carry;
+			digit = product & std::numeric_limits<DigitType>::max();
+			carry = product >> std::numeric_limits<DigitType>::digits;
+		}
+		if (carry) {
+			n.digits.push_back(carry);
+		}
+	}
+
+	const char* first;
+	const char* last;
+	// powers[k] == 10^(c * 2^k)
+	std::vector<Unsigned> powers;
+};
+
+void Unsigned::readDecimal(std::istream& in, Unsigned& out)
+{
+	std::string decimalDigits;
+	char c;
+	while (in.get(c)) {
+		if (c >= '0' && c <= '9') {
+			decimalDigits.push_back(c);
+		} else {
+			in.unget();
+			break;
+		}
+	}
+	const char* first = decimalDigits.data();
+	out = parseDecimal(first, first + decimalDigits.size());
+}
+
+Unsigned Unsigned::parseDecimal(const char* first, const char* last)
+{
+	return DecimalParsing(first, last).toUnsigned();
+}
+
+} // namespace MultiPrecision
@@ -5,82 +5,82 @@
 //
 
 
-#include "MultiPrecision/DigitPairType.h"
+#include "MultiPrecision/DigitDivisor.h"
 #include "MultiPrecision/DivisionByZero.h"
 #include "MultiPrecision/Unsigned.h"
 #include <limits>
 
 namespace MultiPrecision {
 
-/// Simplified algorithm D for n == 1 from Donald E. Knuth, "The Art of Computer Programming", 2nd vol, 3rd ed, pp 272.
+/// Simplified algorithm D for n == 1 from Donald E. Knuth, "The Art of Computer Programming", 2nd vol, 3rd ed, pp 272,
+/// keeping the running remainder in a single digit and dividing two digits by one with the reciprocal of DigitDivisor.
+/// The quotient may replace the dividend.
 class Unsigned::DivisionByDigitType
 {
 public:
-	DivisionByDigitType(const Unsigned& dividend, DigitType divisor) : divisor(divisor)
+	DivisionByDigitType(const decltype(Unsigned::digits)& dividend, const DigitDivisor& divisor) :
+		dividend(dividend),
+		divisor(divisor)
 	{
-		// Sufficient space including an extra digit appended in calculateQuotientDigit() below.
-		remainder.digits.reserve(dividend.digits.size() + 1);
-		remainder.digits.assign(dividend.digits.begin(), dividend.digits.end());
 	}
 
-	Unsigned::DivisionResult getQuotientAndRemainder()
+	// Store the quotient in result, and return the remainder.
+	DigitType divideDigits(decltype(Unsigned::digits)& result) const
 	{
-		loopOverQuotientDigits();
-		quotient.trimMostSignificantDigit();
-		remainder.digits.resize(1);
-		return Unsigned::DivisionResult({std::move(quotient), std::move(remainder)});
+		std::size_t dividendLength = dividend.size();
+		result.resize(dividendLength);
+		DigitType remainder = 0;
+		for (std::size_t i = dividendLength; i--;) {
+			result[i] = divisor.divide(remainder, dividend[i], remainder);
+		}
+		if (!result.empty() && !result.back()) {
+			result.pop_back();
+		}
+		return remainder;
 	}
 
-	Unsigned getQuotient()
+	DigitType getRemainder() const
 	{
-		loopOverQuotientDigits();
-		quotient.trimMostSignificantDigit();
-		return std::move(quotient);
-	}
-
-	Unsigned getRemainder()
-	{
-		loopOverQuotientDigits();
-		remainder.digits.resize(1);
-		return std::move(remainder);
+		DigitType remainder = 0;
+		for (std::size_t i = dividend.size(); i--;) {
+			divisor.divide(remainder, dividend[i], remainder);
+		}
+		return remainder;
 	}
 
 private:
-	void loopOverQuotientDigits()
-	{
-		std::size_t quotientLength = remainder.digits.size();
-		quotient.digits.assign(quotientLength, 0); // Reserve quotient result space, to be populated in reverse order below.
-		for (std::size_t i = quotientLength; i--;) {
-			calculateQuotientDigit(i);
-			multiplyAndSubtract(i);
-		};
-	}
+	const decltype(Unsigned::digits)& dividend;
+	const DigitDivisor& divisor;
+};
 
-	void calculateQuotientDigit(std::size_t i)
-	{
-		remainder.digits.resize(i + 2);
-		quotient.digits[i] =
-			((DigitPairType(remainder.digits[i + 1]) << std::numeric_limits<DigitType>::digits) + remainder.digits[i]) / divisor;
-	}
+Unsigned::DivisionResult Unsigned::dividedBy(const DigitDivisor& divisor) const
+{
+	Unsigned::DivisionResult result;
+	result.remainder.digits.assign(1, DivisionByDigitType(digits, divisor).divideDigits(result.quotient.digits));
+	return result;
+}
 
-	void multiplyAndSubtract(std::size_t i)
-	{
-		remainderFragment.digits.assign(remainder.digits.begin() + i, remainder.digits.end());
-		remainderFragment -= Unsigned(DigitPairType(divisor) * quotient.digits[i]);
-		remainder.digits.resize(i);
-		remainder.digits.insert(remainder.digits.end(), remainderFragment.digits.begin(), remainderFragment.digits.end());
-	}
+Unsigned& Unsigned::operator/=(const DigitDivisor& divisor)
+{
+	divideInPlace(divisor);
+	return *this;
+}
 
-	DigitType divisor;
-	Unsigned remainder;
-	Unsigned quotient;
-	Unsigned remainderFragment;
-};
+Unsigned& Unsigned::operator%=(const DigitDivisor& divisor)
+{
+	digits.assign(1, DivisionByDigitType(digits, divisor).getRemainder());
+	return *this;
+}
+
+Unsigned::DigitType Unsigned::divideInPlace(const DigitDivisor& divisor)
+{
+	return DivisionByDigitType(digits, divisor).divideDigits(digits);
+}
 
 Unsigned::DivisionResult Unsigned::dividedBy(DigitType divisor) const
 {
 	if (divisor) {
-		return DivisionByDigitType(*this, divisor).getQuotientAndRemainder();
+		return dividedBy(DigitDivisor(divisor));
 	} else {
 		throw DivisionByZero("Unsigned::dividedBy(DigitType): divisor is zero!");
 	}
@@ -89,8 +89,7 @@ Unsigned::DivisionResult Unsigned::dividedBy(DigitType divisor) const
 Unsigned& Unsigned::operator/=(DigitType divisor)
 {
 	if (divisor) {
-		*this = DivisionByDigitType(*this, divisor).getQuotient();
-		return *this;
+		return *this /= DigitDivisor(divisor);
 	} else {
 		throw DivisionByZero("Unsigned::operator/=(DigitType): divisor is zero!");
 	}
@@ -99,8 +98,7 @@ Unsigned& Unsigned::operator/=(DigitType divisor)
 Unsigned& Unsigned::operator%=(DigitType divisor)
 {
 	if (divisor) {
-		*this = DivisionByDigitType(*this, divisor).getRemainder();
-		return *this;
+		return *this %= DigitDivisor(divisor);
 	} else {
 		throw DivisionByZero("Unsigned::operator%=(DigitType): divisor is zero!");
 	}
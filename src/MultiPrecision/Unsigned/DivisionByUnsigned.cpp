@@ -8,11 +8,15 @@
 #include "MultiPrecision/DigitPairType.h"
 #include "MultiPrecision/DivisionByZero.h"
 #include "MultiPrecision/Unsigned.h"
+#include <algorithm>
 #include <limits>
+#include <utility>
 
 namespace MultiPrecision {
 
-/// Algorithm D from Donald E. Knuth, "The Art of Computer Programming", 2nd vol, 3rd ed, pp 272.
+/// Algorithm D from Donald E. Knuth, "The Art of Computer Programming", 2nd vol, 3rd ed, pp 272. Multiplication and
+/// subtraction of the divisor are fused into a single pass over the remainder digits, which are kept in place in a
+/// buffer allocated once on construction.
 class Unsigned::DivisionByUnsigned
 {
 public:
@@ -23,7 +27,7 @@ public:
 		expansionShift(divisorLength * std::numeric_limits<DigitType>::digits - divisor.mostSignificantBitPosition()),
 		divisor(divisor << expansionShift)
 	{
-		// Sufficient space for expansion shift result, including an extra digit appended in calculateQuotientDigit() below.
+		// Sufficient space for expansion shift result, including an extra most significant digit.
 		remainder.digits.reserve(dividend.digits.size() + expansionShift / std::numeric_limits<DigitType>::digits + 2);
 		remainder.digits.assign(dividend.digits.begin(), dividend.digits.end());
 		remainder <<= expansionShift;
@@ -36,7 +40,6 @@ public:
 		}
 		quotient.trimMostSignificantDigit();
 		reduceRemainder();
-		remainder.digits.resize(divisorLength);
 		return Unsigned::DivisionResult({std::move(quotient), std::move(remainder)});
 	}
 
@@ -55,7 +58,6 @@ public:
 			loopOverQuotientDigits();
 		}
 		reduceRemainder();
-		remainder.digits.resize(divisorLength);
 		return std::move(remainder);
 	}
 
@@ -66,6 +68,7 @@ private:
 	{
 		std::size_t quotientLength = remainder.digits.size() - divisorLength + 1;
 		quotient.digits.resize(quotientLength);
+		remainder.digits.push_back(0);
 		for (std::size_t i = quotientLength; i--;) {
 			calculateQuotientDigit(i);
 			multiplyAndSubtract(i);
@@ -74,7 +77,6 @@ private:
 
 	void calculateQuotientDigit(std::size_t i)
 	{
-		remainder.digits.resize(i + divisorLength + 1);
 		DigitPairType trialDividend =
 			(static_cast<DigitPairType>(remainder.digits[i + divisorLength]) << std::numeric_limits<DigitType>::digits) +
 			remainder.digits[i + divisorLength - 1];
@@ -97,26 +99,51 @@ private:
 		}
 	}
 
+	// Subtract trialQuotient * divisor from the divisorLength + 1 remainder digits starting at i.
 	void multiplyAndSubtract(std::size_t i)
 	{
-		remainderFragment.digits.assign(remainder.digits.begin() + i, remainder.digits.end());
-		if (remainderFragment.subtractAndTestNegative(divisor * trialQuotient)) {
+		DigitType* r = remainder.digits.data() + i;
+		const DigitType* d = divisor.digits.data();
+		const std::size_t n = divisorLength;
+		const DigitType q = static_cast<DigitType>(trialQuotient);
+		DigitType carry = 0;
+		DigitType borrow = 0;
+		for (std::size_t j = 0; j < n; ++j) {
+			DigitPairType product = static_cast<DigitPairType>(d[j]) * q + carry;
+			DigitType low = static_cast<DigitType>(product);
+			carry = static_cast<DigitType>(product >> std::numeric_limits<DigitType>::digits);
+			DigitType difference = r[j] - low;
+			DigitType nextBorrow = r[j] < low;
+			r[j] = difference - borrow;
+			borrow = nextBorrow | (difference < borrow);
+		}
+		DigitType difference = r[n] - carry;
+		bool negative = r[n] < carry || difference < borrow;
+		r[n] = difference - borrow;
+		if (negative) {
 			addBack(i);
 		}
-		remainder.digits.resize(i);
-		remainder.digits.insert(remainder.digits.end(), remainderFragment.digits.begin(), remainderFragment.digits.end());
 	}
 
+	// Add the divisor back to the remainder digits starting at i, discarding the final carry.
 	void addBack(std::size_t i)
 	{
 		--quotient.digits[i];
-		remainderFragment += divisor;
-		remainderFragment.digits.pop_back();
+		DigitType* r = remainder.digits.data() + i;
+		const DigitType* d = divisor.digits.data();
+		DigitType carry = 0;
+		for (std::size_t j = 0; j < divisorLength; ++j) {
+			DigitPairType sum = static_cast<DigitPairType>(r[j]) + d[j] + carry;
+			r[j] = sum & std::numeric_limits<DigitType>::max();
+			carry = sum >> std::numeric_limits<DigitType>::digits;
+		}
+		r[divisorLength] += carry;
 	}
 
 	// Revert fraction expansion
 	void reduceRemainder()
 	{
+		remainder.digits.resize(divisorLength);
 		remainder >>= expansionShift;
 	}
 
@@ -127,19 +154,363 @@ private:
 	Unsigned quotient;
 	DigitPairType trialQuotient;
 	DigitPairType trialRemainder;
-	Unsigned remainderFragment;
 };
 
-Unsigned::DivisionResult Unsigned::dividedBy(const Unsigned& other) const
+/// Recursive division from Christoph Burnikel, Joachim Ziegler, "Fast Recursive Division", Max-Planck-Institut für
+/// Informatik, Research Report MPI-I-98-1-022, 1998. The dividend is divided in radix 2^n for a divisor of n bits, each
+/// digit of the quotient by a division of 2n by n bits. That one takes two divisions of 3n/2 by n bits, each calculated by
+/// a recursive division of n by n/2 bits and a multiplication of n/2 by n/2 bits, and so benefits from fast
+/// multiplication.
+class Unsigned::RecursiveDivisionByUnsigned
 {
-	if (!other.isZero()) {
+public:
+	static bool isApplicable(const Unsigned& dividend, const Unsigned& divisor) noexcept
+	{
+		std::size_t divisorLength = divisor.mostSignificantDigitPosition();
+		return divisorLength >= BURNIKEL_ZIEGLER_THRESHOLD &&
+			dividend.mostSignificantDigitPosition() >= divisorLength + BURNIKEL_ZIEGLER_THRESHOLD;
+	}
+
+	RecursiveDivisionByUnsigned(const Unsigned& dividend, const Unsigned& divisor) : dividend(dividend), divisor(divisor)
+	{
+	}
+
+	// Dividend and divisor are expanded by a common power of 2 to make the divisor fill whole digits, so the blocks of
+	// dividend and quotient are digit slices, and each takes time linear in the divisor length besides its division.
+	Unsigned::DivisionResult getQuotientAndRemainder()
+	{
+		const std::size_t length = divisor.mostSignificantDigitPosition();
+		const std::size_t n = length * std::numeric_limits<DigitType>::digits;
+		const std::size_t expansionShift = n - divisor.mostSignificantBitPosition();
+		const Unsigned b = divisor << expansionShift;
+		const Unsigned a = dividend << expansionShift;
+		const std::size_t dividendLength = a.mostSignificantDigitPosition();
+		const std::size_t blocks = (dividendLength + length - 1) / length;
 		Unsigned::DivisionResult result;
-		if (other.digits.size() != 1) {
-			result = DivisionByUnsigned(*this, other).getQuotientAndRemainder();
+		result.quotient.digits.assign(blocks * length, 0);
+		Unsigned partial;
+		for (std::size_t position = blocks * length; position > 0;) {
+			position -= length;
+			// Partial dividend remainder * 2^n + block.
+			std::size_t blockEnd = std::min(position + length, dividendLength);
+			partial.digits.assign(a.digits.begin() + position, a.digits.begin() + blockEnd);
+			partial.digits.resize(length, 0);
+			result.remainder.trim();
+			partial.digits.insert(partial.digits.end(), result.remainder.digits.begin(), result.remainder.digits.end());
+			Unsigned::DivisionResult step = divide2nBy1n(std::move(partial), b, n);
+			// Each quotient block is less than 2^n, leaving any further digits zero.
+			std::size_t stepLength = std::min(step.quotient.digits.size(), length);
+			std::copy(
+				step.quotient.digits.begin(),
+				step.quotient.digits.begin() + stepLength,
+				result.quotient.digits.begin() + position);
+			result.remainder = std::move(step.remainder);
+		}
+		result.quotient.trim();
+		result.remainder >>= expansionShift;
+		return result;
+	}
+
+	Unsigned getQuotient()
+	{
+		return std::move(getQuotientAndRemainder().quotient);
+	}
+
+	Unsigned getRemainder()
+	{
+		return std::move(getQuotientAndRemainder().remainder);
+	}
+
+private:
+	// Divisor length in digits from which on recursive division outperforms Algorithm D.
+	static constexpr std::size_t BURNIKEL_ZIEGLER_THRESHOLD = 150;
+
+	// Division of a < 2^n * b by b of n bits.
+	static Unsigned::DivisionResult divide2nBy1n(Unsigned a, Unsigned b, std::size_t n)
+	{
+		if (n < BURNIKEL_ZIEGLER_THRESHOLD * std::numeric_limits<DigitType>::digits ||
+			a.mostSignificantBitPosition() < n + BURNIKEL_ZIEGLER_THRESHOLD * std::numeric_limits<DigitType>::digits) {
+			return divideBySchoolbook(a, b);
+		}
+		bool padded = n % 2;
+		if (padded) {
+			a <<= 1;
+			b <<= 1;
+			++n;
+		}
+		std::size_t half = n / 2;
+		Unsigned b1 = b >> half;
+		Unsigned b2 = bitsOf(b, 0, half);
+		Unsigned::DivisionResult high = divide3nBy2n(a >> n, bitsOf(a, half, half), b, b1, b2, half);
+		Unsigned::DivisionResult low = divide3nBy2n(high.remainder, bitsOf(a, 0, half), b, b1, b2, half);
+		low.quotient += high.quotient << half;
+		if (padded) {
+			low.remainder >>= 1;
+		}
+		return low;
+	}
+
+	// Division of a12 * 2^n + a3 < 2^n * b by b = b1 * 2^n + b2 of 2n bits.
+	static Unsigned::DivisionResult divide3nBy2n(
+		const Unsigned& a12,
+		const Unsigned& a3,
+		const Unsigned& b,
+		const Unsigned& b1,
+		const Unsigned& b2,
+		std::size_t n)
+	{
+		Unsigned::DivisionResult result;
+		if (a12 >> n == b1) {
+			result.quotient = (Unsigned(1) << n) - Unsigned(1);
+			result.remainder = a12 - (b1 << n) + b1;
 		} else {
-			result = dividedBy(other.digits.front());
+			result = divide2nBy1n(a12, b1, n);
+		}
+		// The estimated quotient exceeds the quotient by at most 2.
+		Unsigned dividend = (result.remainder << n) + a3;
+		Unsigned subtrahend = result.quotient * b2;
+		while (dividend < subtrahend) {
+			--result.quotient;
+			dividend += b;
 		}
+		result.remainder = std::move(dividend -= subtrahend);
 		return result;
+	}
+
+	static Unsigned::DivisionResult divideBySchoolbook(const Unsigned& a, const Unsigned& b)
+	{
+		if (b.digits.size() != 1) {
+			return DivisionByUnsigned(a, b).getQuotientAndRemainder();
+		} else {
+			return a.dividedBy(b.digits.front());
+		}
+	}
+
+	// Bits of number from position on, as many as count.
+	static Unsigned bitsOf(const Unsigned& number, std::size_t position, std::size_t count)
+	{
+		Unsigned result;
+		std::size_t digitPosition = position / std::numeric_limits<DigitType>::digits;
+		std::size_t bitShift = position % std::numeric_limits<DigitType>::digits;
+		std::size_t numberLength = number.digits.size();
+		std::size_t length = (count + std::numeric_limits<DigitType>::digits - 1) / std::numeric_limits<DigitType>::digits;
+		result.digits.assign(length, 0);
+		for (std::size_t i = 0; i < length && digitPosition + i < numberLength; ++i) {
+			DigitType digit = number.digits[digitPosition + i] >> bitShift;
+			if (bitShift && digitPosition + i + 1 < numberLength) {
+				digit |= number.digits[digitPosition + i + 1] << (std::numeric_limits<DigitType>::digits - bitShift);
+			}
+			result.digits[i] = digit;
+		}
+		if (count % std::numeric_limits<DigitType>::digits) {
+			result.digits.back() &= (DigitType(1) << (count % std::numeric_limits<DigitType>::digits)) - 1;
+		}
+		return result.trim();
+	}
+
+	const Unsigned& dividend;
+	const Unsigned& divisor;
+};
+
+/// Division in linear time by divisors of the forms 2^k, 2^k - 1 and 2^k + 1. Powers of 2 take a shift and a mask.
+/// Otherwise, with B = 2^k, the dividend is split into chunks of k bits, which are digits of radix B. Remainders are
+/// their sum by B == 1 mod B - 1, and their alternating sum by B == -1 mod B + 1, kept reduced by subtracting or adding
+/// the divisor at most once per chunk. Quotients are calculated chunk by chunk from the most significant one, like by
+/// a single digit: with remainder r so far and next chunk c, r * B + c == r * (B - 1) + (r + c) == r * (B + 1) - (r - c),
+/// so each chunk of the quotient is r, or r plus or minus 1, and the remainder is r + c or c - r corrected by the
+/// divisor at most once.
+class Unsigned::DivisionBySpecialForm
+{
+public:
+	enum class Form
+	{
+		NONE,
+		POWER_OF_TWO,
+		POWER_OF_TWO_MINUS_ONE,
+		POWER_OF_TWO_PLUS_ONE
+	};
+
+	// Form of a divisor of more than one digit, and NONE for those of less than SPECIAL_FORM_THRESHOLD digits not being
+	// powers of 2.
+	static Form formOf(const Unsigned& divisor) noexcept
+	{
+		const std::size_t length = divisor.mostSignificantDigitPosition();
+		if (length < 2) {
+			return Form::NONE;
+		}
+		const DigitType top = divisor.digits[length - 1];
+		const bool topIsPowerOfTwo = (top & (top - 1)) == 0;
+		const bool topIsPowerOfTwoMinusOne = (top & (top + 1)) == 0;
+		bool lowAreZero = true;
+		bool lowAreOnes = true;
+		for (std::size_t i = 1; i + 1 < length && (lowAreZero || lowAreOnes); ++i) {
+			lowAreZero = lowAreZero && divisor.digits[i] == 0;
+			lowAreOnes = lowAreOnes && divisor.digits[i] == std::numeric_limits<DigitType>::max();
+		}
+		if (topIsPowerOfTwo && lowAreZero && divisor.digits.front() == 0) {
+			return Form::POWER_OF_TWO;
+		} else if (length < SPECIAL_FORM_THRESHOLD) {
+			return Form::NONE;
+		} else if (topIsPowerOfTwoMinusOne && lowAreOnes && divisor.digits.front() == std::numeric_limits<DigitType>::max()) {
+			return Form::POWER_OF_TWO_MINUS_ONE;
+		} else if (topIsPowerOfTwo && lowAreZero && divisor.digits.front() == 1) {
+			return Form::POWER_OF_TWO_PLUS_ONE;
+		} else {
+			return Form::NONE;
+		}
+	}
+
+	// Divisor of form 2^k, 2^k - 1 or 2^k + 1, with k > 0 for the latter.
+	DivisionBySpecialForm(const Unsigned& dividend, const Unsigned& divisor, Form form) :
+		dividend(dividend),
+		divisor(divisor),
+		form(form),
+		k(form == Form::POWER_OF_TWO_MINUS_ONE ? divisor.mostSignificantBitPosition()
+											   : divisor.mostSignificantBitPosition() - 1)
+	{
+	}
+
+	Unsigned::DivisionResult getQuotientAndRemainder() const
+	{
+		Unsigned::DivisionResult result;
+		if (form == Form::POWER_OF_TWO) {
+			result.quotient = dividend >> k;
+			lowBitsOf(dividend, k, result.remainder);
+		} else {
+			divideByChunks(result.quotient, result.remainder);
+		}
+		return result;
+	}
+
+	Unsigned getQuotient() const
+	{
+		Unsigned quotient;
+		if (form == Form::POWER_OF_TWO) {
+			quotient = dividend >> k;
+		} else {
+			Unsigned remainder;
+			divideByChunks(quotient, remainder);
+		}
+		return quotient;
+	}
+
+	Unsigned getRemainder() const
+	{
+		Unsigned remainder;
+		if (form == Form::POWER_OF_TWO) {
+			lowBitsOf(dividend, k, remainder);
+		} else {
+			Unsigned chunk;
+			std::size_t numberOfChunks = (dividend.mostSignificantBitPosition() + k - 1) / k;
+			for (std::size_t i = 0; i < numberOfChunks; ++i) {
+				bitsOf(dividend, i * k, k, chunk);
+				if (form == Form::POWER_OF_TWO_MINUS_ONE || i % 2 == 0) {
+					remainder += chunk;
+					if (remainder >= divisor) {
+						remainder -= divisor;
+					}
+				} else if (remainder >= chunk) {
+					remainder -= chunk;
+				} else {
+					remainder += divisor;
+					remainder -= chunk;
+				}
+			}
+			remainder.trim();
+		}
+		return remainder;
+	}
+
+	// Bits of n from 0 up to count into out, reusing its digits.
+	static void lowBitsOf(const Unsigned& n, std::size_t count, Unsigned& out)
+	{
+		bitsOf(n, 0, count, out);
+	}
+
+private:
+	// Divisor length in digits from which on division by chunks outperforms Algorithm D for forms 2^k - 1 and 2^k + 1.
+	static constexpr std::size_t SPECIAL_FORM_THRESHOLD = 8;
+
+	void divideByChunks(Unsigned& quotient, Unsigned& remainder) const
+	{
+		std::size_t numberOfChunks = (dividend.mostSignificantBitPosition() + k - 1) / k;
+		quotient.digits.assign(dividend.digits.size(), 0);
+		remainder.digits.clear();
+		Unsigned chunk;
+		Unsigned quotientChunk;
+		for (std::size_t i = numberOfChunks; i-- > 0;) {
+			bitsOf(dividend, i * k, k, chunk);
+			quotientChunk = remainder;
+			if (form == Form::POWER_OF_TWO_MINUS_ONE) {
+				// r * B + c == r * (B - 1) + r + c, with r + c < 2 * (B - 1)
+				chunk += remainder;
+				if (chunk >= divisor) {
+					chunk -= divisor;
+					++quotientChunk;
+				}
+			} else if (chunk >= remainder) {
+				// r * B + c == r * (B + 1) + c - r
+				chunk -= remainder;
+			} else {
+				// r * B + c == (r - 1) * (B + 1) + B + 1 + c - r
+				chunk += divisor;
+				chunk -= remainder;
+				--quotientChunk;
+			}
+			std::swap(remainder, chunk);
+			insertBits(quotientChunk, i * k, quotient);
+		}
+		quotient.trim();
+		remainder.trim();
+	}
+
+	// Bits of n from position up to position + count into out, reusing its digits.
+	static void bitsOf(const Unsigned& n, std::size_t position, std::size_t count, Unsigned& out)
+	{
+		constexpr std::size_t bits = std::numeric_limits<DigitType>::digits;
+		const std::size_t digitPosition = position / bits;
+		const std::size_t bitShift = position % bits;
+		const std::size_t length = n.digits.size();
+		count = std::min(count, length * bits > position ? length * bits - position : 0);
+		out.digits.assign((count + bits - 1) / bits, 0);
+		for (std::size_t i = 0; i < out.digits.size() && digitPosition + i < length; ++i) {
+			out.digits[i] = n.digits[digitPosition + i] >> bitShift;
+			if (bitShift && digitPosition + i + 1 < length) {
+				out.digits[i] |= n.digits[digitPosition + i + 1] << (bits - bitShift);
+			}
+		}
+		if (count % bits) {
+			out.digits.back() &= (DigitType(1) << (count % bits)) - 1;
+		}
+		out.trim();
+	}
+
+	// Add value, which has no bits set in out from position up to its length, at position of out.
+	static void insertBits(const Unsigned& value, std::size_t position, Unsigned& out)
+	{
+		constexpr std::size_t bits = std::numeric_limits<DigitType>::digits;
+		const std::size_t digitPosition = position / bits;
+		const std::size_t bitShift = position % bits;
+		const std::size_t length = out.digits.size();
+		for (std::size_t i = 0; i < value.digits.size() && digitPosition + i < length; ++i) {
+			out.digits[digitPosition + i] |= value.digits[i] << bitShift;
+			if (bitShift && digitPosition + i + 1 < length) {
+				out.digits[digitPosition + i + 1] |= value.digits[i] >> (bits - bitShift);
+			}
+		}
+	}
+
+	const Unsigned& dividend;
+	const Unsigned& divisor;
+	const Form form;
+	// Divisor 2^k, 2^k - 1 or 2^k + 1
+	const std::size_t k;
+};
+
+Unsigned::DivisionResult Unsigned::dividedBy(const Unsigned& other) const
+{
+	if (!other.isZero()) {
+		return divide(*this, other, DivisionParts::QUOTIENT_AND_REMAINDER);
 	} else {
 		throw DivisionByZero("Unsigned::dividedBy(const Unsigned&): divisor is zero!");
 	}
@@ -148,11 +519,7 @@ Unsigned::DivisionResult Unsigned::dividedBy(const Unsigned& other) const
 Unsigned& Unsigned::operator/=(const Unsigned& other)
 {
 	if (!other.isZero()) {
-		if (other.digits.size() != 1) {
-			*this = DivisionByUnsigned(*this, other).getQuotient();
-		} else {
-			*this /= other.digits.front();
-		}
+		*this = std::move(divide(*this, other, DivisionParts::QUOTIENT).quotient);
 		return *this;
 	} else {
 		throw DivisionByZero("Unsigned::operator/=(const Unsigned&): divisor is zero!");
@@ -162,11 +529,7 @@ Unsigned& Unsigned::operator/=(const Unsigned& other)
 Unsigned& Unsigned::operator%=(const Unsigned& other)
 {
 	if (!other.isZero()) {
-		if (other.digits.size() != 1) {
-			*this = DivisionByUnsigned(*this, other).getRemainder();
-		} else {
-			*this %= other.digits.front();
-		}
+		*this = std::move(divide(*this, other, DivisionParts::REMAINDER).remainder);
 		return *this;
 	} else {
 		throw DivisionByZero("Unsigned::operator%=(const Unsigned&): divisor is zero!");
@@ -176,7 +539,7 @@ Unsigned& Unsigned::operator%=(const Unsigned& other)
 Unsigned operator/(const Unsigned& lhs, const Unsigned& rhs)
 {
 	if (!rhs.isZero()) {
-		return Unsigned::DivisionByUnsigned(lhs, rhs).getQuotient();
+		return std::move(Unsigned::divide(lhs, rhs, Unsigned::DivisionParts::QUOTIENT).quotient);
 	} else {
 		throw DivisionByZero("operator/(const Unsigned&, const Unsigned&): divisor is zero!");
 	}
@@ -185,10 +548,71 @@ Unsigned operator/(const Unsigned& lhs, const Unsigned& rhs)
 Unsigned operator%(const Unsigned& lhs, const Unsigned& rhs)
 {
 	if (!rhs.isZero()) {
-		return Unsigned::DivisionByUnsigned(lhs, rhs).getRemainder();
+		return std::move(Unsigned::divide(lhs, rhs, Unsigned::DivisionParts::REMAINDER).remainder);
 	} else {
 		throw DivisionByZero("operator%(const Unsigned&, const Unsigned&): divisor is zero!");
 	}
 }
 
+/// Divisors of a single digit are tested first, as that is cheapest, then those of special form, before choosing
+/// between recursive division and Algorithm D by length.
+Unsigned::DivisionResult Unsigned::divide(const Unsigned& dividend, const Unsigned& divisor, DivisionParts parts)
+{
+	auto partsOf = [parts](auto&& division) {
+		switch (parts) {
+		case DivisionParts::QUOTIENT:
+			return DivisionResult({division.getQuotient(), Unsigned()});
+		case DivisionParts::REMAINDER:
+			return DivisionResult({Unsigned(), division.getRemainder()});
+		default:
+			return division.getQuotientAndRemainder();
+		}
+	};
+	if (divisor.digits.size() == 1) {
+		DivisionResult result;
+		if (parts == DivisionParts::QUOTIENT) {
+			(result.quotient = dividend) /= divisor.digits.front();
+		} else if (parts == DivisionParts::REMAINDER) {
+			(result.remainder = dividend) %= divisor.digits.front();
+		} else {
+			result = dividend.dividedBy(divisor.digits.front());
+		}
+		return result;
+	}
+	DivisionBySpecialForm::Form form = DivisionBySpecialForm::formOf(divisor);
+	if (form != DivisionBySpecialForm::Form::NONE) {
+		return partsOf(DivisionBySpecialForm(dividend, divisor, form));
+	} else if (RecursiveDivisionByUnsigned::isApplicable(dividend, divisor)) {
+		return partsOf(RecursiveDivisionByUnsigned(dividend, divisor));
+	} else {
+		return partsOf(DivisionByUnsigned(dividend, divisor));
+	}
+}
+
+Unsigned Unsigned::modPow2(std::size_t k) const
+{
+	Unsigned remainder;
+	DivisionBySpecialForm::lowBitsOf(*this, k, remainder);
+	return remainder;
+}
+
+Unsigned Unsigned::divPow2(std::size_t k) const
+{
+	return *this >> k;
+}
+
+Unsigned Unsigned::modMersenne(std::size_t k) const
+{
+	if (k == 0) {
+		throw DivisionByZero("Unsigned::modMersenne(std::size_t): divisor is zero!");
+	}
+	Unsigned divisor = (Unsigned(1) << k) - Unsigned(1);
+	if (divisor.trim().digits.size() == 1) {
+		Unsigned remainder(*this);
+		remainder %= divisor.digits.front();
+		return remainder;
+	}
+	return DivisionBySpecialForm(*this, divisor, DivisionBySpecialForm::Form::POWER_OF_TWO_MINUS_ONE).getRemainder();
+}
+
 } // namespace MultiPrecision
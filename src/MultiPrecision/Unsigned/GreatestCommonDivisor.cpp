@@ -0,0 +1,482 @@
+//
+// Copyright (C) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#include "MultiPrecision/DigitPairType.h"
+#include "MultiPrecision/Unsigned.h"
+#include "MultiPrecision/math.h"
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <utility>
+
+namespace MultiPrecision {
+
+/// Greatest common divisor by steps replacing a by a - q * b or b by b - q * a, which leave the greatest common divisor
+/// unchanged. The steps taken are products of nonnegative matrices of determinant 1, which map the numbers reduced back
+/// to the numbers given, and by which the coefficients of the extended greatest common divisor are tracked.
+///
+/// Numbers fitting into DigitPairType are reduced by binary GCD, Algorithm B from Donald E. Knuth, "The Art of Computer
+/// Programming", 2nd vol, 3rd ed, pp 338. Larger numbers are reduced by Lehmer's method, Algorithm L ibid. pp 347, taking
+/// as many quotients as their leading 2 digits determine into one matrix of single digits, which is applied in a single
+/// pass. Quotients are accepted as long as bounds of the numbers reduced, by the digits dropped, yield the same quotient.
+/// From HALF_GCD_THRESHOLD digits on, the leading third is reduced by half GCD, which recursively reduces the leading half
+/// of its leading half, and applies the resulting matrices to the full numbers by multiplication. This takes O(M(n) log n)
+/// for multiplication time M(n). Niels Möller, "On Schönhage's algorithm and subquadratic integer gcd computation",
+/// Mathematics of Computation 77 (2008), pp 589-607.
+class Unsigned::GreatestCommonDivisor
+{
+public:
+	GreatestCommonDivisor(const Unsigned& lhs, const Unsigned& rhs) : lhs(lhs), rhs(rhs)
+	{
+	}
+
+	Unsigned getGcd()
+	{
+		Unsigned a(lhs);
+		Unsigned b(rhs);
+		reduceToGcd(a, b, nullptr, 0);
+		return a.isZero() ? b : a;
+	}
+
+	GcdExtendedResult getGcdExtended()
+	{
+		GcdExtendedResult result;
+		result.xNegative = false;
+		result.yNegative = false;
+		if (rhs.isZero()) {
+			result.gcd = lhs;
+			result.x = Unsigned(lhs.isZero() ? 0ULL : 1ULL);
+		} else if (lhs.isZero()) {
+			result.gcd = rhs;
+			result.y = Unsigned(1);
+		} else {
+			// The lower row of the matrix M with (lhs, rhs) == M * (a, b), and its inverse row yields the coefficients of
+			// whichever of a and b ends as the greatest common divisor.
+			Unsigned a(lhs);
+			Unsigned b(rhs);
+			Row row{Unsigned(), Unsigned(1)};
+			reduceToGcd(a, b, &row, 1);
+			if (b.isZero()) {
+				// a == u11 * lhs - u01 * rhs
+				result.gcd = std::move(a);
+				result.x = std::move(row.right);
+				result.y = (result.x * lhs - result.gcd) / rhs;
+				result.yNegative = !result.y.isZero();
+			} else {
+				// b == u00 * rhs - u10 * lhs
+				result.gcd = std::move(b);
+				result.x = std::move(row.left);
+				result.y = (result.x * lhs + result.gcd) / rhs;
+				result.xNegative = !result.x.isZero();
+			}
+		}
+		return result;
+	}
+
+private:
+	// Number of leading bits determining the quotients of a Lehmer step, such that bounds fit into DigitPairType.
+	static constexpr std::size_t LEADING_BITS = 2 * std::numeric_limits<DigitType>::digits - 2;
+	// Length in digits from which on half GCD outperforms Lehmer steps.
+	static constexpr std::size_t HALF_GCD_THRESHOLD = 400;
+	// Length in digits from which on half GCD recurses instead of taking Lehmer steps.
+	static constexpr std::size_t HALF_GCD_RECURSION_THRESHOLD = 120;
+
+	// Row of a nonnegative matrix of determinant 1.
+	struct Row
+	{
+		Unsigned left;
+		Unsigned right;
+	};
+
+	using Matrix = std::array<Row, 2>;
+
+	// Nonnegative matrix of determinant 1 of single digit entries, by rows.
+	struct DigitMatrix
+	{
+		DigitType u00;
+		DigitType u01;
+		DigitType u10;
+		DigitType u11;
+	};
+
+	// Reduce a and b until one is 0, multiplying numberOfRows rows by the steps taken.
+	void reduceToGcd(Unsigned& a, Unsigned& b, Row* rows, std::size_t numberOfRows)
+	{
+		while (!a.isZero() && !b.isZero()) {
+			std::size_t length = std::max(a.mostSignificantDigitPosition(), b.mostSignificantDigitPosition());
+			if (length >= HALF_GCD_THRESHOLD && reduceByLeadingDigits(a, b, 2 * length / 3, rows, numberOfRows)) {
+				continue;
+			} else if (numberOfRows == 0 && length <= 2) {
+				a = fromDigitPair(binaryGcd(toDigitPair(a), toDigitPair(b)));
+				b = Unsigned();
+			} else if (!lehmerStep(a, b, 0, rows, numberOfRows)) {
+				divisionStep(a, b, rows, numberOfRows);
+			}
+		}
+	}
+
+	// Reduce a and b of n digits at most by steps keeping both of more than s = n / 2 + 1 digits, until their difference
+	// has s digits at most, multiplying the rows of matrix by the steps taken. Whether any step was taken.
+	bool halfGcd(Unsigned& a, Unsigned& b, Row* matrix)
+	{
+		const std::size_t length = std::max(a.mostSignificantDigitPosition(), b.mostSignificantDigitPosition());
+		const std::size_t s = length / 2 + 1;
+		const std::size_t bound = s * std::numeric_limits<DigitType>::digits;
+		if (std::min(a.mostSignificantDigitPosition(), b.mostSignificantDigitPosition()) <= s) {
+			return false;
+		}
+		bool progress = false;
+		if (length >= HALF_GCD_RECURSION_THRESHOLD) {
+			progress = reduceByLeadingDigits(a, b, length / 2, matrix, 2);
+			while (std::max(a.mostSignificantDigitPosition(), b.mostSignificantDigitPosition()) > 3 * length / 4 + 1) {
+				if (!boundedStep(a, b, bound, matrix, 2)) {
+					return progress;
+				}
+				progress = true;
+			}
+			const std::size_t reducedLength = std::max(a.mostSignificantDigitPosition(), b.mostSignificantDigitPosition());
+			if (reducedLength > s + 2) {
+				progress |= reduceByLeadingDigits(a, b, 2 * s - reducedLength + 1, matrix, 2);
+			}
+		}
+		while (boundedStep(a, b, bound, matrix, 2)) {
+			progress = true;
+		}
+		return progress;
+	}
+
+	// Reduce a and b by half GCD of their digits from position on, whose reduction carries over to the full numbers, and
+	// multiply numberOfRows rows by its matrix. Whether a reduction was applied.
+	bool reduceByLeadingDigits(Unsigned& a, Unsigned& b, std::size_t position, Row* rows, std::size_t numberOfRows)
+	{
+		const std::size_t bits = position * std::numeric_limits<DigitType>::digits;
+		Unsigned aHigh = a >> bits;
+		Unsigned bHigh = b >> bits;
+		Matrix matrix{Row{Unsigned(1), Unsigned()}, Row{Unsigned(), Unsigned(1)}};
+		if (!halfGcd(aHigh, bHigh, matrix.data())) {
+			return false;
+		}
+		// With (aHigh, bHigh) reduced, (a, b) == M * (aHigh * 2^bits + u11 * aLow - u01 * bLow, bHigh * 2^bits + u00 * bLow -
+		// u10 * aLow), both positive by the bounds half GCD keeps.
+		Unsigned aLow = lowDigitsOf(a, position);
+		Unsigned bLow = lowDigitsOf(b, position);
+		(aHigh <<= bits) += matrix[1].right * aLow;
+		(bHigh <<= bits) += matrix[0].left * bLow;
+		Unsigned aSubtrahend = matrix[0].right * bLow;
+		Unsigned bSubtrahend = matrix[1].left * aLow;
+		if (aHigh < aSubtrahend || bHigh < bSubtrahend) {
+			return false;
+		}
+		a = std::move(aHigh -= aSubtrahend);
+		b = std::move(bHigh -= bSubtrahend);
+		for (std::size_t i = 0; i < numberOfRows; ++i) {
+			Unsigned left = rows[i].left * matrix[0].left + rows[i].right * matrix[1].left;
+			rows[i].right = rows[i].left * matrix[0].right + rows[i].right * matrix[1].right;
+			rows[i].left = std::move(left);
+		}
+		return true;
+	}
+
+	// A Lehmer step, or a division step if that takes no quotient, keeping a and b of at least 2^bound.
+	bool boundedStep(Unsigned& a, Unsigned& b, std::size_t bound, Row* rows, std::size_t numberOfRows)
+	{
+		return lehmerStep(a, b, bound, rows, numberOfRows) || boundedDivisionStep(a, b, bound, rows, numberOfRows);
+	}
+
+	// Reduce a and b by the quotients their leading bits determine, keeping both of at least 2^bound. Whether any quotient
+	// was taken.
+	bool lehmerStep(Unsigned& a, Unsigned& b, std::size_t bound, Row* rows, std::size_t numberOfRows)
+	{
+		DigitMatrix matrix = lehmerMatrixOf(a, b, bound);
+		if (matrix.u01 == 0 && matrix.u10 == 0) {
+			return false;
+		}
+		// (a, b) == M * (u11 * a - u01 * b, u00 * b - u10 * a)
+		multiplySubtract(a, matrix.u11, b, matrix.u01, buffer);
+		multiplySubtract(b, matrix.u00, a, matrix.u10, otherBuffer);
+		std::swap(a, buffer);
+		std::swap(b, otherBuffer);
+		for (std::size_t i = 0; i < numberOfRows; ++i) {
+			multiplyAdd(rows[i].left, matrix.u00, rows[i].right, matrix.u10, buffer);
+			multiplyAdd(rows[i].left, matrix.u01, rows[i].right, matrix.u11, otherBuffer);
+			std::swap(rows[i].left, buffer);
+			std::swap(rows[i].right, otherBuffer);
+		}
+		return true;
+	}
+
+	// Matrix of the quotients determined by the leading bits x and y of a and b, which bound a' and b' reduced as
+	// (a' / 2^shift, b' / 2^shift) in (x - u01, x + u11) x (y - u10, y + u00). A quotient is taken if both bounds of a' / b'
+	// or of b' / a' yield it, and the lower bound of the remainder is at least 2^bound.
+	static DigitMatrix lehmerMatrixOf(const Unsigned& a, const Unsigned& b, std::size_t bound) noexcept
+	{
+		DigitMatrix matrix{1, 0, 0, 1};
+		const std::size_t bits = std::max(a.mostSignificantBitPosition(), b.mostSignificantBitPosition());
+		const std::size_t shift = bits > LEADING_BITS ? bits - LEADING_BITS : 0;
+		if (bound >= shift + LEADING_BITS) {
+			return matrix;
+		}
+		const DigitPairType minimum = bound > shift ? DigitPairType(1) << (bound - shift) : 1;
+		const DigitPairType maxDigit = std::numeric_limits<DigitType>::max();
+		DigitPairType x = leadingBitsOf(a, shift);
+		DigitPairType y = leadingBitsOf(b, shift);
+		DigitPairType u00 = 1;
+		DigitPairType u01 = 0;
+		DigitPairType u10 = 0;
+		DigitPairType u11 = 1;
+		for (;;) {
+			if (x >= y) {
+				if (y <= u10 || x < u01) {
+					break;
+				}
+				DigitPairType quotient = quotientOf(x - u01, y + u00);
+				if (quotient == 0 || quotient > maxDigit || !isQuotientOf(quotient, x + u11, y - u10)) {
+					break;
+				}
+				DigitPairType remainder = x - quotient * y;
+				DigitPairType v01 = u01 + quotient * u00;
+				DigitPairType v11 = u11 + quotient * u10;
+				if (v01 > maxDigit || v11 > maxDigit || remainder < v01 || remainder - v01 < minimum) {
+					break;
+				}
+				x = remainder;
+				u01 = v01;
+				u11 = v11;
+			} else {
+				if (x <= u01 || y < u10) {
+					break;
+				}
+				DigitPairType quotient = quotientOf(y - u10, x + u11);
+				if (quotient == 0 || quotient > maxDigit || !isQuotientOf(quotient, y + u00, x - u01)) {
+					break;
+				}
+				DigitPairType remainder = y - quotient * x;
+				DigitPairType v10 = u10 + quotient * u11;
+				DigitPairType v00 = u00 + quotient * u01;
+				if (v10 > maxDigit || v00 > maxDigit || remainder < v10 || remainder - v10 < minimum) {
+					break;
+				}
+				y = remainder;
+				u10 = v10;
+				u00 = v00;
+			}
+		}
+		matrix.u00 = DigitType(u00);
+		matrix.u01 = DigitType(u01);
+		matrix.u10 = DigitType(u10);
+		matrix.u11 = DigitType(u11);
+		return matrix;
+	}
+
+	// Quotient n / d, taking the most frequent quotients 0 to 3 by subtraction, as divisions of DigitPairType are slow.
+	static DigitPairType quotientOf(DigitPairType n, DigitPairType d) noexcept
+	{
+		for (DigitPairType quotient = 0; quotient < 4; ++quotient) {
+			if (n < d) {
+				return quotient;
+			}
+			n -= d;
+		}
+		return n / d + 4;
+	}
+
+	// Whether quotient == n / d, by a multiplication not exceeding n for quotients of a lower bound of n / d.
+	static bool isQuotientOf(DigitPairType quotient, DigitPairType n, DigitPairType d) noexcept
+	{
+		DigitPairType product = quotient * d;
+		return product <= n && n - product < d;
+	}
+
+	// Replace the larger of a and b by its remainder, which may be 0.
+	void divisionStep(Unsigned& a, Unsigned& b, Row* rows, std::size_t numberOfRows)
+	{
+		const bool reduceA = a >= b;
+		Unsigned& larger = reduceA ? a : b;
+		const Unsigned& smaller = reduceA ? b : a;
+		if (numberOfRows == 0) {
+			larger %= smaller;
+		} else {
+			DivisionResult result = larger.dividedBy(smaller);
+			larger = std::move(result.remainder);
+			updateRows(result.quotient, reduceA, rows, numberOfRows);
+		}
+	}
+
+	// Replace the larger of a and b by its remainder, or that plus the smaller one if less than 2^bound, unless they
+	// differ by less than 2^bound. Whether a step was taken.
+	bool boundedDivisionStep(Unsigned& a, Unsigned& b, std::size_t bound, Row* rows, std::size_t numberOfRows)
+	{
+		const bool reduceA = a >= b;
+		Unsigned& larger = reduceA ? a : b;
+		const Unsigned& smaller = reduceA ? b : a;
+		if ((larger - smaller).mostSignificantBitPosition() <= bound) {
+			return false;
+		}
+		DivisionResult result = larger.dividedBy(smaller);
+		if (result.remainder.mostSignificantBitPosition() <= bound) {
+			--result.quotient;
+			result.remainder += smaller;
+		}
+		larger = std::move(result.remainder);
+		updateRows(result.quotient, reduceA, rows, numberOfRows);
+		return true;
+	}
+
+	// Multiply rows by (1, q; 0, 1) for a reduced by q * b, or by (1, 0; q, 1) for b reduced by q * a.
+	static void updateRows(const Unsigned& quotient, bool reducedA, Row* rows, std::size_t numberOfRows)
+	{
+		for (std::size_t i = 0; i < numberOfRows; ++i) {
+			if (reducedA) {
+				rows[i].right += quotient * rows[i].left;
+			} else {
+				rows[i].left += quotient * rows[i].right;
+			}
+		}
+	}
+
+	// out = x * xFactor + y * yFactor, with out being neither x nor y.
+	static void multiplyAdd(const Unsigned& x, DigitType xFactor, const Unsigned& y, DigitType yFactor, Unsigned& out)
+	{
+		constexpr std::size_t bits = std::numeric_limits<DigitType>::digits;
+		const std::size_t xLength = x.digits.size();
+		const std::size_t yLength = y.digits.size();
+		const std::size_t length = std::max(xLength, yLength);
+		out.digits.resize(length);
+		DigitType xCarry = 0;
+		DigitType yCarry = 0;
+		DigitType carry = 0;
+		for (std::size_t i = 0; i < length; ++i) {
+			DigitPairType xProduct = DigitPairType(i < xLength ? x.digits[i] : 0) * xFactor + xCarry;
+			DigitPairType yProduct = DigitPairType(i < yLength ? y.digits[i] : 0) * yFactor + yCarry;
+			DigitPairType sum = (xProduct & std::numeric_limits<DigitType>::max()) + (yProduct & std::numeric_limits<DigitType>::max()) + carry;
+			out.digits[i] = DigitType(sum);
+			xCarry = DigitType(xProduct >> bits);
+			yCarry = DigitType(yProduct >> bits);
+			carry = DigitType(sum >> bits);
+		}
+		DigitPairType top = DigitPairType(xCarry) + yCarry + carry;
+		out.digits.push_back(DigitType(top));
+		out.digits.push_back(DigitType(top >> bits));
+		out.trim();
+	}
+
+	// out = x * xFactor - y * yFactor, which must not be negative, with out being neither x nor y.
+	static void multiplySubtract(const Unsigned& x, DigitType xFactor, const Unsigned& y, DigitType yFactor, Unsigned& out)
+	{
+		constexpr std::size_t bits = std::numeric_limits<DigitType>::digits;
+		const std::size_t xLength = x.digits.size();
+		const std::size_t yLength = y.digits.size();
+		const std::size_t length = std::max(xLength, yLength);
+		out.digits.resize(length);
+		DigitType xCarry = 0;
+		DigitType yCarry = 0;
+		DigitType borrow = 0;
+		for (std::size_t i = 0; i < length; ++i) {
+			DigitPairType xProduct = DigitPairType(i < xLength ? x.digits[i] : 0) * xFactor + xCarry;
+			DigitPairType yProduct = DigitPairType(i < yLength ? y.digits[i] : 0) * yFactor + yCarry;
+			DigitType minuend = DigitType(xProduct);
+			DigitType subtrahend = DigitType(yProduct);
+			out.digits[i] = minuend - subtrahend - borrow;
+			borrow = minuend < subtrahend || (minuend == subtrahend && borrow);
+			xCarry = DigitType(xProduct >> bits);
+			yCarry = DigitType(yProduct >> bits);
+		}
+		out.digits.push_back(xCarry - yCarry - borrow);
+		out.trim();
+	}
+
+	// Bits of n from shift up to shift + LEADING_BITS.
+	static DigitPairType leadingBitsOf(const Unsigned& n, std::size_t shift) noexcept
+	{
+		constexpr std::size_t bits = std::numeric_limits<DigitType>::digits;
+		const std::size_t digitPosition = shift / bits;
+		const std::size_t bitShift = shift % bits;
+		const std::size_t length = n.digits.size();
+		auto digitAt = [&n, length](std::size_t i) { return DigitPairType(i < length ? n.digits[i] : 0); };
+		DigitPairType value = (digitAt(digitPosition) | digitAt(digitPosition + 1) << bits) >> bitShift;
+		if (bitShift) {
+			value |= digitAt(digitPosition + 2) << (2 * bits - bitShift);
+		}
+		return value & ((DigitPairType(1) << LEADING_BITS) - 1);
+	}
+
+	static Unsigned lowDigitsOf(const Unsigned& n, std::size_t count)
+	{
+		Unsigned low(n);
+		low.digits.resize(std::min(count, n.digits.size()));
+		return low.trim();
+	}
+
+	static DigitPairType toDigitPair(const Unsigned& n) noexcept
+	{
+		DigitPairType value = 0;
+		for (std::size_t i = n.digits.size(); i-- > 0;) {
+			value = value << std::numeric_limits<DigitType>::digits | n.digits[i];
+		}
+		return value;
+	}
+
+	static Unsigned fromDigitPair(DigitPairType value)
+	{
+		Unsigned n;
+		n.digits.push_back(DigitType(value));
+		n.digits.push_back(DigitType(value >> std::numeric_limits<DigitType>::digits));
+		return n.trim();
+	}
+
+	// Binary GCD of u and v, not both 0.
+	static DigitPairType binaryGcd(DigitPairType u, DigitPairType v) noexcept
+	{
+		if (u == 0 || v == 0) {
+			return u | v;
+		}
+		std::size_t shift = 0;
+		for (; ((u | v) & 1) == 0; ++shift) {
+			u >>= 1;
+			v >>= 1;
+		}
+		while ((u & 1) == 0) {
+			u >>= 1;
+		}
+		do {
+			while ((v & 1) == 0) {
+				v >>= 1;
+			}
+			if (u > v) {
+				std::swap(u, v);
+			}
+			v -= u;
+		} while (v != 0);
+		return u << shift;
+	}
+
+	const Unsigned& lhs;
+	const Unsigned& rhs;
+	// Digits reused by Lehmer steps.
+	Unsigned buffer;
+	Unsigned otherBuffer;
+};
+
+Unsigned gcd(const Unsigned& a, const Unsigned& b)
+{
+	return Unsigned::GreatestCommonDivisor(a, b).getGcd();
+}
+
+Unsigned lcm(const Unsigned& a, const Unsigned& b)
+{
+	if (a.isZero() || b.isZero()) {
+		return Unsigned();
+	}
+	return a / gcd(a, b) * b;
+}
+
+GcdExtendedResult gcdExtended(const Unsigned& a, const Unsigned& b)
+{
+	return Unsigned::GreatestCommonDivisor(a, b).getGcdExtended();
+}
+
+} // namespace MultiPrecision
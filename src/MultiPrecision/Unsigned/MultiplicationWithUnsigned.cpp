@@ -6,6 +6,7 @@
 
 
 #include "MultiPrecision/DigitPairType.h"
+#include "MultiPrecision/NumberTheoreticTransform.h"
 #include "MultiPrecision/Unsigned.h"
 #include <iostream>
 #include <limits>
@@ -18,12 +19,48 @@ public:
 	MultiplicationWithUnsigned(const Unsigned& multiplicand, const Unsigned& multiplier) :
 		multiplicand(multiplicand),
 		multiplier(multiplier),
-		multiplicandLength(multiplicand.digits.size()),
-		multiplierLength(multiplier.digits.size())
+		multiplicandLength(multiplicand.mostSignificantDigitPosition()),
+		multiplierLength(multiplier.mostSignificantDigitPosition()),
+		squaring(&multiplicand == &multiplier)
 	{
 	}
 
 	Unsigned getProduct()
+	{
+		if (squaring && multiplicandLength < KARATSUBA_THRESHOLD) {
+			squareBySchoolbook();
+		} else if (multiplicandLength < KARATSUBA_THRESHOLD || multiplierLength < KARATSUBA_THRESHOLD) {
+			multiplyBySchoolbook();
+		} else if (multiplicandLength >= 2 * multiplierLength || multiplierLength >= 2 * multiplicandLength) {
+			multiplyUnbalanced();
+		} else if (multiplicandLength < TOOM_COOK_3_THRESHOLD || multiplierLength < TOOM_COOK_3_THRESHOLD) {
+			multiplyByKaratsuba();
+		} else if (multiplicandLength < TOOM_COOK_4_THRESHOLD || multiplierLength < TOOM_COOK_4_THRESHOLD) {
+			multiplyByToomCook3();
+		} else if (
+			multiplicandLength < NUMBER_THEORETIC_TRANSFORM_THRESHOLD || multiplierLength < NUMBER_THEORETIC_TRANSFORM_THRESHOLD ||
+			(multiplicandLength + multiplierLength) * CHUNKS_PER_DIGIT > NumberTheoreticTransform::MAX_PRODUCT_LENGTH) {
+			multiplyByToomCook4();
+		} else {
+			multiplyByNumberTheoreticTransform();
+		}
+		product.trimMostSignificantDigit();
+		return std::move(product);
+	}
+
+private:
+	// Operand length in digits from which on both operands are split recursively rather than multiplied digit by digit.
+	static constexpr std::size_t KARATSUBA_THRESHOLD = 48;
+	// Operand lengths in digits from which on Toom-Cook splits into 3 and 4 parts outperform the split into 2 parts.
+	static constexpr std::size_t TOOM_COOK_3_THRESHOLD = 150;
+	static constexpr std::size_t TOOM_COOK_4_THRESHOLD = 400;
+	// Operand length in digits from which on the convolution is calculated by number theoretic transforms.
+	static constexpr std::size_t NUMBER_THEORETIC_TRANSFORM_THRESHOLD = 1500;
+	static constexpr std::size_t CHUNKS_PER_DIGIT =
+		std::numeric_limits<DigitType>::digits / std::numeric_limits<NumberTheoreticTransform::ChunkType>::digits;
+	static_assert(std::numeric_limits<DigitType>::digits % std::numeric_limits<NumberTheoreticTransform::ChunkType>::digits == 0);
+
+	void multiplyBySchoolbook()
 	{
 		product.digits.resize(multiplicandLength + multiplierLength);
 		for (std::size_t j = 0; j < multiplierLength; ++j) {
@@ -35,15 +72,306 @@ public:
 			}
 			product.digits[multiplicandLength + j] = carry;
 		}
-		product.trimMostSignificantDigit();
-		return std::move(product);
 	}
 
-private:
+	// Calculate the products of different digits only once, then double them and add the squares of all digits.
+	void squareBySchoolbook()
+	{
+		product.digits.assign(2 * multiplicandLength, 0);
+		for (std::size_t j = 0; j < multiplicandLength; ++j) {
+			DigitPairType carry = 0;
+			for (std::size_t i = j + 1; i < multiplicandLength; ++i) {
+				DigitPairType tmp = DigitPairType(multiplicand.digits[i]) * multiplicand.digits[j] + product.digits[i + j] + carry;
+				product.digits[i + j] = tmp & std::numeric_limits<DigitType>::max();
+				carry = tmp >> std::numeric_limits<DigitType>::digits;
+			}
+			product.digits[multiplicandLength + j] = carry;
+		}
+		DigitPairType carry = 0;
+		DigitType shiftedOut = 0;
+		for (std::size_t i = 0; i < multiplicandLength; ++i) {
+			DigitPairType square = DigitPairType(multiplicand.digits[i]) * multiplicand.digits[i];
+			for (std::size_t k = 2 * i; k < 2 * i + 2; ++k) {
+				DigitType doubled = (product.digits[k] << 1) | shiftedOut;
+				shiftedOut = product.digits[k] >> (std::numeric_limits<DigitType>::digits - 1);
+				DigitPairType tmp = carry + doubled + (square & std::numeric_limits<DigitType>::max());
+				product.digits[k] = tmp & std::numeric_limits<DigitType>::max();
+				carry = tmp >> std::numeric_limits<DigitType>::digits;
+				square >>= std::numeric_limits<DigitType>::digits;
+			}
+		}
+	}
+
+	// Cut the longer operand into slices of the shorter operand's length, so that each partial product is balanced.
+	void multiplyUnbalanced()
+	{
+		const bool multiplicandIsLonger = multiplicandLength >= multiplierLength;
+		const Unsigned& longer = multiplicandIsLonger ? multiplicand : multiplier;
+		const Unsigned& shorter = multiplicandIsLonger ? multiplier : multiplicand;
+		const std::size_t longerLength = std::max(multiplicandLength, multiplierLength);
+		const std::size_t sliceLength = std::min(multiplicandLength, multiplierLength);
+		product.digits.assign(multiplicandLength + multiplierLength, 0);
+		for (std::size_t offset = 0; offset < longerLength; offset += sliceLength) {
+			addShifted(digitsOf(longer, offset, sliceLength) * shorter, offset);
+		}
+	}
+
+	/// Karatsuba's method from Donald E. Knuth, "The Art of Computer Programming", 2nd vol, 3rd ed, pp 295.
+	void multiplyByKaratsuba()
+	{
+		const std::size_t splitLength = (std::max(multiplicandLength, multiplierLength) + 1) / 2;
+		std::vector<Unsigned> multiplicandParts = partsOf(multiplicand, 2, splitLength);
+		std::vector<Unsigned> distinctMultiplierParts = squaring ? std::vector<Unsigned>() : partsOf(multiplier, 2, splitLength);
+		const std::vector<Unsigned>& multiplierParts = squaring ? multiplicandParts : distinctMultiplierParts;
+		Unsigned low = multiplicandParts[0] * multiplierParts[0];
+		Unsigned high = multiplicandParts[1] * multiplierParts[1];
+		Unsigned middle = multiplyAtPoint(multiplicandParts, multiplierParts, 1);
+		middle -= low;
+		middle -= high;
+		product.digits.assign(multiplicandLength + multiplierLength, 0);
+		addShifted(low, 0);
+		addShifted(middle, splitLength);
+		addShifted(high, 2 * splitLength);
+	}
+
+	/// Toom-Cook method from Donald E. Knuth, "The Art of Computer Programming", 2nd vol, 3rd ed, pp 296, evaluating the
+	/// product polynomial r(x) = r0 + ... + r4 x^4 at 0, +-1, 2 and infinity.
+	void multiplyByToomCook3()
+	{
+		const std::size_t splitLength = (std::max(multiplicandLength, multiplierLength) + 2) / 3;
+		std::vector<Unsigned> multiplicandParts = partsOf(multiplicand, 3, splitLength);
+		std::vector<Unsigned> distinctMultiplierParts = squaring ? std::vector<Unsigned>() : partsOf(multiplier, 3, splitLength);
+		const std::vector<Unsigned>& multiplierParts = squaring ? multiplicandParts : distinctMultiplierParts;
+		Unsigned r0 = multiplicandParts[0] * multiplierParts[0];
+		Unsigned r4 = multiplicandParts[2] * multiplierParts[2];
+		Unsigned even1;
+		Unsigned odd1;
+		multiplyAtOppositePoints(multiplicandParts, multiplierParts, 1, even1, odd1);
+		Unsigned value2 = multiplyAtPoint(multiplicandParts, multiplierParts, 2);
+		// even1 == r0 + r2 + r4, odd1 == r1 + r3, value2 == r0 + 2 r1 + 4 r2 + 8 r3 + 16 r4
+		Unsigned r2 = std::move(even1);
+		r2 -= r0;
+		r2 -= r4;
+		Unsigned r3 = std::move(value2);
+		r3 -= r0;
+		r3 -= r2 << 2;
+		r3 -= r4 << 4;
+		r3 >>= 1;
+		r3 -= odd1;
+		r3 /= 3;
+		Unsigned r1 = std::move(odd1);
+		r1 -= r3;
+		product.digits.assign(multiplicandLength + multiplierLength, 0);
+		addShifted(r0, 0);
+		addShifted(r1, splitLength);
+		addShifted(r2, 2 * splitLength);
+		addShifted(r3, 3 * splitLength);
+		addShifted(r4, 4 * splitLength);
+	}
+
+	/// Toom-Cook method as above, evaluating the product polynomial r(x) = r0 + ... + r6 x^6 at 0, +-1, +-2, 3 and infinity.
+	void multiplyByToomCook4()
+	{
+		const std::size_t splitLength = (std::max(multiplicandLength, multiplierLength) + 3) / 4;
+		std::vector<Unsigned> multiplicandParts = partsOf(multiplicand, 4, splitLength);
+		std::vector<Unsigned> distinctMultiplierParts = squaring ? std::vector<Unsigned>() : partsOf(multiplier, 4, splitLength);
+		const std::vector<Unsigned>& multiplierParts = squaring ? multiplicandParts : distinctMultiplierParts;
+		Unsigned r0 = multiplicandParts[0] * multiplierParts[0];
+		Unsigned r6 = multiplicandParts[3] * multiplierParts[3];
+		Unsigned even1;
+		Unsigned odd1;
+		multiplyAtOppositePoints(multiplicandParts, multiplierParts, 1, even1, odd1);
+		Unsigned even2;
+		Unsigned odd2;
+		multiplyAtOppositePoints(multiplicandParts, multiplierParts, 2, even2, odd2);
+		Unsigned value3 = multiplyAtPoint(multiplicandParts, multiplierParts, 3);
+		// even1 == r0 + r2 + r4 + r6, even2 == r0 + 4 r2 + 16 r4 + 64 r6
+		Unsigned r2 = std::move(even1);
+		r2 -= r0;
+		r2 -= r6;
+		Unsigned r4 = std::move(even2);
+		r4 -= r0;
+		r4 -= r6 << 6;
+		r4 -= r2 << 2;
+		r4 /= 12;
+		r2 -= r4;
+		// odd1 == r1 + r3 + r5, odd2 == 2 r1 + 8 r3 + 32 r5, value3 - (even part at 3) == 3 r1 + 27 r3 + 243 r5
+		Unsigned r3PlusTimes10r5 = std::move(value3);
+		r3PlusTimes10r5 -= r0;
+		r3PlusTimes10r5 -= r2 * 9;
+		r3PlusTimes10r5 -= r4 * 81;
+		r3PlusTimes10r5 -= r6 * 729;
+		r3PlusTimes10r5 -= odd1 * 3;
+		r3PlusTimes10r5 /= 24;
+		Unsigned r3 = std::move(odd2);
+		r3 -= odd1 << 1;
+		r3 /= 6; // r3 + 5 r5 so far
+		Unsigned r5 = std::move(r3PlusTimes10r5);
+		r5 -= r3;
+		r5 /= 5;
+		r3 -= r5 * 5;
+		Unsigned r1 = std::move(odd1);
+		r1 -= r3;
+		r1 -= r5;
+		product.digits.assign(multiplicandLength + multiplierLength, 0);
+		addShifted(r0, 0);
+		addShifted(r1, splitLength);
+		addShifted(r2, 2 * splitLength);
+		addShifted(r3, 3 * splitLength);
+		addShifted(r4, 4 * splitLength);
+		addShifted(r5, 5 * splitLength);
+		addShifted(r6, 6 * splitLength);
+	}
+
+	void multiplyByNumberTheoreticTransform()
+	{
+		std::vector<NumberTheoreticTransform::ChunkType> multiplicandChunks = chunksOf(multiplicand, multiplicandLength);
+		std::vector<NumberTheoreticTransform::ChunkType> productChunks = squaring ?
+			NumberTheoreticTransform::multiply(multiplicandChunks, multiplicandChunks) :
+			NumberTheoreticTransform::multiply(multiplicandChunks, chunksOf(multiplier, multiplierLength));
+		product.digits.assign(multiplicandLength + multiplierLength, 0);
+		for (std::size_t i = 0; i < productChunks.size(); ++i) {
+			product.digits[i / CHUNKS_PER_DIGIT] |= DigitType(productChunks[i])
+				<< (i % CHUNKS_PER_DIGIT * std::numeric_limits<NumberTheoreticTransform::ChunkType>::digits);
+		}
+	}
+
+	static std::vector<NumberTheoreticTransform::ChunkType> chunksOf(const Unsigned& number, std::size_t length)
+	{
+		std::vector<NumberTheoreticTransform::ChunkType> chunks(length * CHUNKS_PER_DIGIT);
+		for (std::size_t i = 0; i < chunks.size(); ++i) {
+			chunks[i] = number.digits[i / CHUNKS_PER_DIGIT] >>
+				(i % CHUNKS_PER_DIGIT * std::numeric_limits<NumberTheoreticTransform::ChunkType>::digits);
+		}
+		return chunks;
+	}
+
+	// Multiply both polynomials at point, squaring if both are given by the same parts.
+	static Unsigned multiplyAtPoint(
+		const std::vector<Unsigned>& multiplicandParts,
+		const std::vector<Unsigned>& multiplierParts,
+		DigitType point)
+	{
+		Unsigned multiplicandValue = evaluate(multiplicandParts, point);
+		if (&multiplicandParts == &multiplierParts) {
+			return multiplicandValue * multiplicandValue;
+		} else {
+			return multiplicandValue * evaluate(multiplierParts, point);
+		}
+	}
+
+	// Multiply both polynomials at point and -point, returning the even and odd parts of the product polynomial at point,
+	// (r(point) + r(-point)) / 2 and (r(point) - r(-point)) / 2. Both are non-negative, as are all coefficients.
+	static void multiplyAtOppositePoints(
+		const std::vector<Unsigned>& multiplicandParts,
+		const std::vector<Unsigned>& multiplierParts,
+		DigitType point,
+		Unsigned& even,
+		Unsigned& odd)
+	{
+		Unsigned multiplicandEven;
+		Unsigned multiplicandOdd;
+		evaluate(multiplicandParts, point, multiplicandEven, multiplicandOdd);
+		Unsigned multiplicandValue = multiplicandEven + multiplicandOdd;
+		Unsigned multiplicandOppositeValue = difference(multiplicandEven, multiplicandOdd);
+		Unsigned valueAtPoint;
+		Unsigned valueAtOpposite;
+		bool valueAtOppositeIsNegative;
+		if (&multiplicandParts == &multiplierParts) {
+			valueAtPoint = multiplicandValue * multiplicandValue;
+			valueAtOpposite = multiplicandOppositeValue * multiplicandOppositeValue;
+			valueAtOppositeIsNegative = false;
+		} else {
+			Unsigned multiplierEven;
+			Unsigned multiplierOdd;
+			evaluate(multiplierParts, point, multiplierEven, multiplierOdd);
+			valueAtPoint = multiplicandValue * (multiplierEven + multiplierOdd);
+			valueAtOpposite = multiplicandOppositeValue * difference(multiplierEven, multiplierOdd);
+			valueAtOppositeIsNegative = (multiplicandEven < multiplicandOdd) != (multiplierEven < multiplierOdd);
+		}
+		if (valueAtOppositeIsNegative) {
+			even = valueAtPoint - valueAtOpposite;
+			odd = std::move(valueAtPoint += valueAtOpposite);
+		} else {
+			even = valueAtPoint + valueAtOpposite;
+			odd = std::move(valueAtPoint -= valueAtOpposite);
+		}
+		even >>= 1;
+		odd >>= 1;
+	}
+
+	static Unsigned evaluate(const std::vector<Unsigned>& parts, DigitType point)
+	{
+		Unsigned even;
+		Unsigned odd;
+		evaluate(parts, point, even, odd);
+		return even += odd;
+	}
+
+	// Evaluate the sums of even and odd powers separately, with parts as coefficients.
+	static void evaluate(const std::vector<Unsigned>& parts, DigitType point, Unsigned& even, Unsigned& odd)
+	{
+		DigitType power = 1;
+		for (std::size_t i = 0; i < parts.size(); ++i) {
+			Unsigned& sum = i % 2 ? odd : even;
+			if (power == 1) {
+				sum += parts[i];
+			} else {
+				sum += parts[i] * power;
+			}
+			power *= point;
+		}
+	}
+
+	static Unsigned difference(const Unsigned& lhs, const Unsigned& rhs)
+	{
+		return lhs < rhs ? rhs - lhs : lhs - rhs;
+	}
+
+	static std::vector<Unsigned> partsOf(const Unsigned& number, std::size_t count, std::size_t length)
+	{
+		std::vector<Unsigned> parts;
+		for (std::size_t i = 0; i < count; ++i) {
+			parts.push_back(digitsOf(number, i * length, length));
+		}
+		return parts;
+	}
+
+	static Unsigned digitsOf(const Unsigned& number, std::size_t offset, std::size_t length)
+	{
+		Unsigned result;
+		std::size_t numberLength = number.digits.size();
+		if (offset < numberLength) {
+			auto first = number.digits.begin() + offset;
+			result.digits.assign(first, first + std::min(length, numberLength - offset));
+			result.trim();
+		}
+		return result;
+	}
+
+	// Add addend * RADIX^offset to the product, which is known to have sufficient length for the carry to settle in.
+	void addShifted(const Unsigned& addend, std::size_t offset)
+	{
+		DigitPairType carry = 0;
+		const std::size_t addendLength = addend.mostSignificantDigitPosition();
+		std::size_t i = 0;
+		for (; i < addendLength; ++i) {
+			DigitPairType tmp = carry + product.digits[offset + i] + addend.digits[i];
+			product.digits[offset + i] = tmp & std::numeric_limits<DigitType>::max();
+			carry = tmp >> std::numeric_limits<DigitType>::digits;
+		}
+		for (; carry; ++i) {
+			DigitPairType tmp = carry + product.digits[offset + i];
+			product.digits[offset + i] = tmp & std::numeric_limits<DigitType>::max();
+			carry = tmp >> std::numeric_limits<DigitType>::digits;
+		}
+	}
+
 	const Unsigned& multiplicand;
 	const Unsigned& multiplier;
 	const std::size_t multiplicandLength;
 	const std::size_t multiplierLength;
+	const bool squaring;
 	Unsigned product;
 };
 
@@ -58,4 +386,9 @@ Unsigned operator*(const Unsigned& lhs, const Unsigned& rhs)
 	return Unsigned::MultiplicationWithUnsigned(lhs, rhs).getProduct();
 }
 
+Unsigned square(const Unsigned& n)
+{
+	return Unsigned::MultiplicationWithUnsigned(n, n).getProduct();
+}
+
 } // namespace MultiPrecision
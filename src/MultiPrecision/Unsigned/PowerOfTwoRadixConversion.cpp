@@ -0,0 +1,133 @@
+//
+// Copyright (C) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:	 LGPL-2.1-or-later
+//
+
+
+#include "MultiPrecision/Unsigned.h"
+#include <algorithm>
+#include <istream>
+#include <limits>
+#include <string>
+
+namespace MultiPrecision {
+
+/// Conversion between digits and characters of radix 2^b, by unpacking and packing b bits per character in a single pass
+/// over the digits. Characters of octal radix may straddle two digits.
+class Unsigned::PowerOfTwoRadixConversion
+{
+public:
+	explicit PowerOfTwoRadixConversion(std::size_t bitsPerCharacter) :
+		bitsPerCharacter(bitsPerCharacter),
+		mask((DigitType(1) << bitsPerCharacter) - 1)
+	{
+	}
+
+	// Write number padded to length characters into first, most significant first, looking up the character of each value
+	// in characters.
+	void write(const Unsigned& number, char* first, std::size_t length, const char* characters) const
+	{
+		std::size_t bits = number.mostSignificantBitPosition();
+		std::fill(first, first + length, characters[0]);
+		for (std::size_t i = 0, bitPosition = 0; bitPosition < bits; ++i, bitPosition += bitsPerCharacter) {
+			first[length - 1 - i] = characters[valueAt(number.digits, bitPosition)];
+		}
+	}
+
+	// Number of valid characters, most significant first, with letters in either case.
+	void read(const char* first, const char* last, Unsigned& out) const
+	{
+		std::size_t length = last - first;
+		std::size_t bits = length * bitsPerCharacter;
+		out.digits.assign((bits + std::numeric_limits<DigitType>::digits - 1) / std::numeric_limits<DigitType>::digits, 0);
+		for (std::size_t i = 0, bitPosition = 0; i < length; ++i, bitPosition += bitsPerCharacter) {
+			DigitType value = valueOf(first[length - 1 - i]);
+			std::size_t digitPosition = bitPosition / std::numeric_limits<DigitType>::digits;
+			std::size_t bitShift = bitPosition % std::numeric_limits<DigitType>::digits;
+			out.digits[digitPosition] |= value << bitShift;
+			if (bitShift + bitsPerCharacter > std::numeric_limits<DigitType>::digits) {
+				out.digits[digitPosition + 1] |= value >> (std::numeric_limits<DigitType>::digits - bitShift);
+			}
+		}
+		out.trim();
+	}
+
+private:
+	static DigitType valueOf(char c) noexcept
+	{
+		return c <= '9' ? c - '0' : (c | ('a' - 'A')) - 'a' + 10;
+	}
+
+	DigitType valueAt(const decltype(Unsigned::digits)& digits, std::size_t bitPosition) const
+	{
+		std::size_t digitPosition = bitPosition / std::numeric_limits<DigitType>::digits;
+		std::size_t bitShift = bitPosition % std::numeric_limits<DigitType>::digits;
+		DigitType value = digits[digitPosition] >> bitShift;
+		if (bitShift + bitsPerCharacter > std::numeric_limits<DigitType>::digits && digitPosition + 1 < digits.size()) {
+			value |= digits[digitPosition + 1] << (std::numeric_limits<DigitType>::digits - bitShift);
+		}
+		return value & mask;
+	}
+
+	const std::size_t bitsPerCharacter;
+	const DigitType mask;
+};
+
+void Unsigned::readHexadecimal(std::istream& in, Unsigned& out)
+{
+	std::string characters;
+	char c;
+	while (in.get(c)) {
+		if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F')) {
+			characters.push_back(c);
+		} else {
+			in.unget();
+			break;
+		}
+	}
+	PowerOfTwoRadixConversion(4).read(characters.data(), characters.data() + characters.size(), out);
+}
+
+void Unsigned::readOctal(std::istream& in, Unsigned& out)
+{
+	std::string characters;
+	char c;
+	while (in.get(c)) {
+		if (c >= '0' && c <= '7') {
+			characters.push_back(c);
+		} else {
+			in.unget();
+			break;
+		}
+	}
+	PowerOfTwoRadixConversion(3).read(characters.data(), characters.data() + characters.size(), out);
+}
+
+std::string Unsigned::toHexadecimalString(bool uppercase) const
+{
+	std::string result((mostSignificantBitPosition() + 3) / 4 + isZero(), '0');
+	formatPowerOfTwoRadix(&result[0], result.size(), 4, uppercase ? "0123456789ABCDEF" : "0123456789abcdef");
+	return result;
+}
+
+std::string Unsigned::toOctalString() const
+{
+	std::string result((mostSignificantBitPosition() + 2) / 3 + isZero(), '0');
+	formatPowerOfTwoRadix(&result[0], result.size(), 3, "01234567");
+	return result;
+}
+
+void Unsigned::formatPowerOfTwoRadix(char* first, std::size_t length, std::size_t bitsPerCharacter, const char* characters) const
+{
+	PowerOfTwoRadixConversion(bitsPerCharacter).write(*this, first, length, characters);
+}
+
+Unsigned Unsigned::parsePowerOfTwoRadix(const char* first, const char* last, std::size_t bitsPerCharacter)
+{
+	Unsigned result;
+	PowerOfTwoRadixConversion(bitsPerCharacter).read(first, last, result);
+	return result;
+}
+
+} // namespace MultiPrecision
@@ -0,0 +1,22 @@
+//
+// Copyright (c) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:      LGPL-2.1-or-later
+//
+
+
+#include "MultiPrecision/math.h"
+
+namespace MultiPrecision {
+
+Unsigned multiPow(const std::vector<Unsigned>& bases, const std::vector<Unsigned>& exponents, const Unsigned& modulus)
+{
+	if (PseudoMersenneModulus::isApplicable(modulus)) {
+		return PseudoMersenneModulus(modulus).multiPow(bases, exponents);
+	} else if (modulus.isOdd() && modulus != Unsigned(1)) {
+		return MontgomeryContext(modulus).multiPow(bases, exponents);
+	}
+	return BarrettReducer(modulus).multiPow(bases, exponents);
+}
+
+} // namespace MultiPrecision
@@ -5,21 +5,15 @@
 //
 
 
+#include "MultiPrecision/SlidingWindowExponentiation.h"
 #include "MultiPrecision/math.h"
 
 namespace MultiPrecision {
 
 Unsigned pow(const Unsigned& base, const Unsigned& exponent)
 {
-	Unsigned power(1);
-	Unsigned multiplier(base);
-	for (auto i : exponent.minimalBitRange()) {
-		if (i) {
-			power *= multiplier;
-		}
-		multiplier *= multiplier;
-	}
-	return power;
+	return slidingWindowPow(
+		base, exponent, Unsigned(1), [](Unsigned& n) { n = square(n); }, [](Unsigned& n, const Unsigned& m) { n *= m; });
 }
 
 } // namespace MultiPrecision
@@ -11,13 +11,21 @@ namespace MultiPrecision {
 
 Unsigned pow(const Unsigned& base, const Unsigned& exponent, const Unsigned& modulus)
 {
+	if (PseudoMersenneModulus::isApplicable(modulus)) {
+		return PseudoMersenneModulus(modulus).pow(base, exponent);
+	} else if (modulus.isOdd() && modulus != Unsigned(1)) {
+		return powm(base, exponent, MontgomeryContext(modulus));
+	} else if (!modulus.isZero() && modulus != Unsigned(1)) {
+		return BarrettReducer(modulus).pow(base, exponent);
+	}
+	// Moduli 0 and 1 keep the plain loop, which leaves the power for exponent 0 unreduced.
 	Unsigned power(1);
 	Unsigned multiplier(base);
 	for (auto i : exponent.minimalBitRange()) {
 		if (i) {
 			power = power * multiplier % modulus;
 		}
-		multiplier = multiplier * multiplier % modulus;
+		multiplier = square(multiplier) % modulus;
 	}
 	return power;
 }
@@ -0,0 +1,17 @@
+//
+// Copyright (c) 2019 Dr. Michael Steffens
+//
+// SPDX-License-Identifier:      LGPL-2.1-or-later
+//
+
+
+#include "MultiPrecision/math.h"
+
+namespace MultiPrecision {
+
+Unsigned powm(const Unsigned& base, const Unsigned& exponent, const MontgomeryContext& context)
+{
+	return context.pow(base, exponent);
+}
+
+} // namespace MultiPrecision
@@ -0,0 +1,101 @@
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include "MultiPrecision/FixedUnsigned.h"
+#include "MultiPrecision/literals.h"
+#include <sstream>
+
+using Unsigned256 = MultiPrecision::FixedUnsigned<256>;
+
+TEST_CASE("FixedUnsigned conversion", "[fixedUnsigned]")
+{
+	SECTION("From and to Unsigned")
+	{
+		MultiPrecision::Unsigned n("0xfeedbabefeedbabefeedbabefeedbabefeedbabe");
+		REQUIRE(MultiPrecision::Unsigned(Unsigned256(n)) == n);
+	}
+	SECTION("From too large Unsigned")
+	{
+		REQUIRE_THROWS(Unsigned256(MultiPrecision::Unsigned(1) << 256));
+	}
+	SECTION("From built-in integer")
+	{
+		REQUIRE(Unsigned256(0xfeedbabefeedbabeULL) == "0xfeedbabefeedbabe");
+	}
+	SECTION("To string")
+	{
+		REQUIRE(Unsigned256("0xfeedbabefeedbabe").toDecimalString() == "18369543784597666494");
+		std::ostringstream out;
+		out << std::hex << Unsigned256("18369543784597666494");
+		REQUIRE(out.str() == "feedbabefeedbabe");
+	}
+}
+
+TEST_CASE("FixedUnsigned arithmetic", "[fixedUnsigned]")
+{
+	Unsigned256 testee("0xfeedbabefeedbabefeedbabefeedbabefeedbabefeedbabefeedbabefeedbabe");
+	Unsigned256 other("0xbabefeedbabefeedbabefeedbabefeedbabefeedbabefeedbabefeedbabefeed");
+	SECTION("Addition modulo 2^256")
+	{
+		REQUIRE(testee + other == "0xb9acb9acb9acb9acb9acb9acb9acb9acb9acb9acb9acb9acb9acb9acb9acb9ab");
+	}
+	SECTION("Subtraction modulo 2^256")
+	{
+		REQUIRE(testee - other == "0x442ebbd1442ebbd1442ebbd1442ebbd1442ebbd1442ebbd1442ebbd1442ebbd1");
+		REQUIRE(other - testee == "0xbbd1442ebbd1442ebbd1442ebbd1442ebbd1442ebbd1442ebbd1442ebbd1442f");
+	}
+	SECTION("Increment and decrement")
+	{
+		Unsigned256 zero;
+		REQUIRE(--zero == "0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff");
+		REQUIRE(++zero == "0x0");
+	}
+	SECTION("Multiplication modulo 2^256")
+	{
+		REQUIRE(testee * other == "0x48d3a30e087a512cc820ff4b87c7ad6a476e5b89071509a7c6bbb7c6866265e6");
+	}
+	SECTION("Division")
+	{
+		REQUIRE(testee / "0xbabefeedbabefeed" == "0x15d77bdc1d3fa1007e81f55238c92afd3b50e7afce18ee745");
+		REQUIRE(testee % "0xbabefeedbabefeed" == "0x9cf529dd9cf529dd");
+	}
+	SECTION("Shifts")
+	{
+		REQUIRE((testee << 100) == "0xeedbabefeedbabefeedbabefeedbabefeedbabe0000000000000000000000000");
+		REQUIRE((testee >> 100) == "0xfeedbabefeedbabefeedbabefeedbabefeedbab");
+		REQUIRE((testee << 256).isZero());
+	}
+	SECTION("Comparison")
+	{
+		REQUIRE(other < testee);
+		REQUIRE(testee >= other);
+		REQUIRE(testee != other);
+	}
+}
+
+TEST_CASE("FixedUnsigned compile time evaluation", "[fixedUnsigned]")
+{
+	using namespace MultiPrecision::literals;
+	constexpr auto prime = 0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffed_u;
+	SECTION("Width of literals")
+	{
+		STATIC_REQUIRE(sizeof(prime) == 32);
+		STATIC_REQUIRE(sizeof(1234567890123456789_u) == 8);
+		STATIC_REQUIRE(sizeof(12345678901234567890_u) > 8);
+	}
+	SECTION("Arithmetic")
+	{
+		constexpr Unsigned256 sum = Unsigned256(prime) + Unsigned256(19_u);
+		STATIC_REQUIRE(sum == Unsigned256(1) << 255);
+		STATIC_REQUIRE(Unsigned256(prime) * Unsigned256(2) == Unsigned256("0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffda"));
+	}
+	SECTION("Unsigned literal")
+	{
+		REQUIRE(
+			57896044618658097711785492504343953926634992332820282019728792003956564819949_mp ==
+			"0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffed");
+		REQUIRE(1'000'000_mp == "1000000");
+		REQUIRE(0b1010_mp == "10");
+		REQUIRE(0777_mp == "511");
+	}
+}
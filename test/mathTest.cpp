@@ -3,6 +3,7 @@
 
 #include "MultiPrecision/math.h"
 #include <sstream>
+#include <vector>
 
 TEST_CASE("Unsigned exponentiation", "[unsigned]")
 {
@@ -39,3 +40,265 @@ TEST_CASE("Unsigned exponentiation over modulus", "[unsigned]")
 		MultiPrecision::pow(MultiPrecision::Unsigned("0x23"), MultiPrecision::Unsigned("0x0815"), prime) ==
 		"0x44b4c02207fd6005f7fc1330633e09c0565fd9c881e3e87bb3b64994cbff1c53");
 }
+
+TEST_CASE("Unsigned exponentiation by large exponents", "[unsigned]")
+{
+	MultiPrecision::Unsigned one(1);
+	MultiPrecision::Unsigned prime("0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffed");
+	MultiPrecision::Unsigned base("0xfeedbabefeedbabefeedbabe");
+	SECTION("Without modulus")
+	{
+		// (2^n + 1)^3 == 2^3n + 3 * 2^2n + 3 * 2^n + 1
+		REQUIRE(
+			MultiPrecision::pow((one << 5000) + one, MultiPrecision::Unsigned(3)) ==
+			(one << 15000) + MultiPrecision::Unsigned(3) * (one << 10000) + MultiPrecision::Unsigned(3) * (one << 5000) + one);
+		REQUIRE(MultiPrecision::pow(MultiPrecision::Unsigned(2), MultiPrecision::Unsigned(12345)) == one << 12345);
+	}
+	SECTION("Odd modulus")
+	{
+		// Fermat's little theorem
+		REQUIRE(MultiPrecision::pow(base, prime - one, prime) == one);
+		REQUIRE(MultiPrecision::pow(base, prime, prime) == base);
+	}
+	SECTION("Even modulus")
+	{
+		MultiPrecision::Unsigned modulus = prime + one;
+		MultiPrecision::Unsigned exponent = prime * prime;
+		REQUIRE(
+			MultiPrecision::pow(base, exponent + prime, modulus) ==
+			MultiPrecision::pow(base, exponent, modulus) * MultiPrecision::pow(base, prime, modulus) % modulus);
+	}
+}
+
+TEST_CASE("Unsigned exponentiation in Montgomery representation", "[unsigned]")
+{
+	MultiPrecision::Unsigned prime("0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffed");
+	MultiPrecision::MontgomeryContext context(prime);
+	SECTION("Conversion")
+	{
+		MultiPrecision::Unsigned n("0xfeedbabefeedbabefeedbabefeedbabefeedbabefeedbabefeedbabefeedbabe");
+		REQUIRE(context.fromMontgomery(context.toMontgomery(n)) == n % prime);
+	}
+	SECTION("Multiplication")
+	{
+		MultiPrecision::Unsigned lhs("0xfeedbabefeedbabe");
+		MultiPrecision::Unsigned rhs("0xbabefeedbabefeedbabefeedbabefeed");
+		REQUIRE(
+			context.fromMontgomery(context.multiply(context.toMontgomery(lhs), context.toMontgomery(rhs))) == lhs * rhs % prime);
+	}
+	SECTION("Exponentiation")
+	{
+		REQUIRE(
+			MultiPrecision::powm(MultiPrecision::Unsigned("0x23"), MultiPrecision::Unsigned("0x0815"), context) ==
+			"0x44b4c02207fd6005f7fc1330633e09c0565fd9c881e3e87bb3b64994cbff1c53");
+		REQUIRE(MultiPrecision::powm(MultiPrecision::Unsigned("0x23"), MultiPrecision::Unsigned("0x0"), context) == "0x1");
+	}
+	SECTION("Even modulus")
+	{
+		REQUIRE_THROWS(MultiPrecision::MontgomeryContext(prime + MultiPrecision::Unsigned(1)));
+	}
+}
+
+TEST_CASE("Unsigned reduction by Barrett's method", "[unsigned]")
+{
+	MultiPrecision::Unsigned modulus("0xfeedbabefeedbabefeedbabefeedbabefeedbabefeedbabefeedbabefeedbabe");
+	MultiPrecision::BarrettReducer reducer(modulus);
+	SECTION("Reduction")
+	{
+		MultiPrecision::Unsigned n = (MultiPrecision::Unsigned(1) << 511) + MultiPrecision::Unsigned("0xbabefeed");
+		REQUIRE(reducer.reduce(n) == n % modulus);
+		REQUIRE(reducer.reduce(n << 100) == (n << 100) % modulus);
+		REQUIRE(reducer.reduce(modulus) == "0x0");
+	}
+	SECTION("Exponentiation over even modulus")
+	{
+		REQUIRE(
+			reducer.pow(MultiPrecision::Unsigned("0x23"), MultiPrecision::Unsigned("0x0815")) ==
+			"0x4e7970e524772af963f85eee3f2458f9829ce71281277ef2d023a830cc82e37f");
+	}
+	SECTION("Zero modulus")
+	{
+		REQUIRE_THROWS(MultiPrecision::BarrettReducer(MultiPrecision::Unsigned()));
+	}
+}
+
+TEST_CASE("Unsigned reduction modulo pseudo-Mersenne numbers", "[unsigned]")
+{
+	MultiPrecision::Unsigned one(1);
+	MultiPrecision::Unsigned prime("0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffed");
+	SECTION("Curve25519 prime")
+	{
+		MultiPrecision::PseudoMersenneModulus modulus(255, MultiPrecision::Unsigned(19));
+		REQUIRE(modulus.getModulus() == prime);
+		REQUIRE(MultiPrecision::PseudoMersenneModulus::isApplicable(prime));
+		MultiPrecision::Unsigned n = (one << 1000) - (one << 300) + MultiPrecision::Unsigned("0xfeedbabe");
+		REQUIRE(modulus.reduce(n) == n % prime);
+		REQUIRE(modulus.reduce(prime) == "0x0");
+		REQUIRE(modulus.reduce(prime - one) == prime - one);
+		REQUIRE(modulus.multiply(prime - one, prime - one) == one);
+	}
+	SECTION("NIST P-256 prime")
+	{
+		// 2^256 - 2^224 + 2^192 + 2^96 - 1
+		MultiPrecision::Unsigned c = (one << 224) - (one << 192) - (one << 96) + one;
+		MultiPrecision::PseudoMersenneModulus modulus(256, c);
+		REQUIRE(modulus.getModulus() == "0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff");
+		REQUIRE_FALSE(MultiPrecision::PseudoMersenneModulus::isApplicable(modulus.getModulus()));
+		MultiPrecision::Unsigned base("0xfeedbabefeedbabefeedbabe");
+		REQUIRE(
+			modulus.pow(base, prime) ==
+			MultiPrecision::powm(base, prime, MultiPrecision::MontgomeryContext(modulus.getModulus())));
+	}
+	SECTION("c of several digits")
+	{
+		MultiPrecision::Unsigned n = (one << 5000) - (one << 3000) + MultiPrecision::Unsigned("0xfeedbabe");
+		for (std::size_t k : {1000, 1024, 1029}) {
+			for (std::size_t cBits : {std::size_t(100), std::size_t(250), k / 2, k - 1}) {
+				MultiPrecision::Unsigned c = (one << (cBits - 1)) + MultiPrecision::Unsigned("0xfeedbabefeedbabefeedbabe");
+				MultiPrecision::PseudoMersenneModulus modulus(k, c);
+				REQUIRE(modulus.reduce(n) == n % modulus.getModulus());
+				REQUIRE(modulus.multiply(n, n) == n * n % modulus.getModulus());
+			}
+		}
+		REQUIRE(MultiPrecision::PseudoMersenneModulus::isApplicable((one << 1024) - (one << 256) + one));
+		REQUIRE_FALSE(MultiPrecision::PseudoMersenneModulus::isApplicable((one << 1024) - (one << 257) + one));
+	}
+	SECTION("Invalid c")
+	{
+		REQUIRE_THROWS(MultiPrecision::PseudoMersenneModulus(255, MultiPrecision::Unsigned()));
+		REQUIRE_THROWS(MultiPrecision::PseudoMersenneModulus(255, (one << 254) + one));
+	}
+}
+
+TEST_CASE("Unsigned exponentiation of a fixed base", "[unsigned]")
+{
+	MultiPrecision::Unsigned prime("0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffed");
+	MultiPrecision::Unsigned base("0xfeedbabefeedbabefeedbabe");
+	SECTION("Odd modulus")
+	{
+		MultiPrecision::FixedBasePow fixedBasePow(base, prime, 256);
+		REQUIRE(fixedBasePow.pow(MultiPrecision::Unsigned()) == "0x1");
+		REQUIRE(fixedBasePow.pow(prime - MultiPrecision::Unsigned(1)) == "0x1");
+		for (const char* exponent : {"0x1", "0x0815", "0xfeedbabe00000000feedbabe", "0xffffffffffffffffffffffffffffffffffffffff"}) {
+			REQUIRE(fixedBasePow.pow(MultiPrecision::Unsigned(exponent)) == MultiPrecision::pow(base, exponent, prime));
+		}
+		REQUIRE_THROWS(fixedBasePow.pow(MultiPrecision::Unsigned(1) << 256));
+	}
+	SECTION("Even modulus")
+	{
+		MultiPrecision::Unsigned modulus = prime + MultiPrecision::Unsigned(1);
+		MultiPrecision::FixedBasePow fixedBasePow(base, modulus, 1000);
+		MultiPrecision::Unsigned exponent = prime * prime * prime;
+		REQUIRE(fixedBasePow.pow(exponent) == MultiPrecision::pow(base, exponent, modulus));
+	}
+	SECTION("Zero modulus")
+	{
+		REQUIRE_THROWS(MultiPrecision::FixedBasePow(base, MultiPrecision::Unsigned(), 256));
+	}
+}
+
+TEST_CASE("Unsigned simultaneous exponentiation", "[unsigned]")
+{
+	MultiPrecision::Unsigned prime("0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffed");
+	std::vector<MultiPrecision::Unsigned> bases = {
+		MultiPrecision::Unsigned("0xfeedbabefeedbabefeedbabe"), MultiPrecision::Unsigned("0x23")};
+	std::vector<MultiPrecision::Unsigned> exponents = {prime - MultiPrecision::Unsigned(2), MultiPrecision::Unsigned("0x0815")};
+	SECTION("Odd modulus")
+	{
+		REQUIRE(
+			MultiPrecision::multiPow(bases, exponents, prime) ==
+			MultiPrecision::pow(bases[0], exponents[0], prime) * MultiPrecision::pow(bases[1], exponents[1], prime) % prime);
+		// Inverse by Fermat's little theorem
+		MultiPrecision::Unsigned inverse =
+			MultiPrecision::multiPow(bases, {prime - MultiPrecision::Unsigned(2), MultiPrecision::Unsigned()}, prime);
+		REQUIRE(inverse * bases[0] % prime == "0x1");
+		REQUIRE(MultiPrecision::multiPow({}, {}, prime) == "0x1");
+	}
+	SECTION("Even modulus")
+	{
+		MultiPrecision::Unsigned modulus = prime + MultiPrecision::Unsigned(1);
+		REQUIRE(
+			MultiPrecision::multiPow(bases, exponents, modulus) ==
+			MultiPrecision::pow(bases[0], exponents[0], modulus) * MultiPrecision::pow(bases[1], exponents[1], modulus) % modulus);
+	}
+	SECTION("Size mismatch")
+	{
+		REQUIRE_THROWS(MultiPrecision::multiPow(bases, {exponents[0]}, prime));
+	}
+}
+
+TEST_CASE("Unsigned greatest common divisor", "[unsigned]")
+{
+	MultiPrecision::Unsigned one(1);
+	auto requireCoefficients = [](const MultiPrecision::Unsigned& a, const MultiPrecision::Unsigned& b) {
+		MultiPrecision::GcdExtendedResult result = MultiPrecision::gcdExtended(a, b);
+		REQUIRE(result.gcd == MultiPrecision::gcd(a, b));
+		REQUIRE_FALSE((result.xNegative && result.yNegative));
+		if (result.xNegative) {
+			REQUIRE(b * result.y - a * result.x == result.gcd);
+		} else if (result.yNegative) {
+			REQUIRE(a * result.x - b * result.y == result.gcd);
+		} else {
+			REQUIRE(a * result.x + b * result.y == result.gcd);
+		}
+	};
+	SECTION("Small numbers")
+	{
+		MultiPrecision::Unsigned zero;
+		REQUIRE(MultiPrecision::gcd(zero, zero) == "0x0");
+		REQUIRE(MultiPrecision::gcd(zero, MultiPrecision::Unsigned("0xfeedbabe")) == "0xfeedbabe");
+		REQUIRE(MultiPrecision::gcd(MultiPrecision::Unsigned(12), MultiPrecision::Unsigned(18)) == "0x6");
+		REQUIRE(MultiPrecision::lcm(MultiPrecision::Unsigned(12), MultiPrecision::Unsigned(18)) == "0x24");
+		REQUIRE(MultiPrecision::lcm(zero, MultiPrecision::Unsigned(18)) == "0x0");
+		requireCoefficients(zero, zero);
+		requireCoefficients(zero, MultiPrecision::Unsigned(18));
+		requireCoefficients(MultiPrecision::Unsigned(12), MultiPrecision::Unsigned(18));
+		requireCoefficients(MultiPrecision::Unsigned(18), MultiPrecision::Unsigned(12));
+	}
+	SECTION("Consecutive Fibonacci numbers")
+	{
+		// All quotients are 1, maximizing the number of steps.
+		MultiPrecision::Unsigned a;
+		MultiPrecision::Unsigned b(1);
+		for (std::size_t n = 0; n < 40000; ++n) {
+			a += b;
+			std::swap(a, b);
+			if (n == 300 || n == 3000 || n == 39999) {
+				REQUIRE(MultiPrecision::gcd(a, b) == one);
+				REQUIRE(MultiPrecision::lcm(a, b) == a * b);
+				requireCoefficients(a, b);
+			}
+		}
+	}
+	SECTION("Mersenne numbers")
+	{
+		// gcd(2^m - 1, 2^n - 1) == 2^gcd(m, n) - 1
+		MultiPrecision::Unsigned a = (one << 40000) - one;
+		MultiPrecision::Unsigned b = (one << 30000) - one;
+		MultiPrecision::Unsigned gcd = (one << 10000) - one;
+		REQUIRE(MultiPrecision::gcd(a, b) == gcd);
+		REQUIRE(MultiPrecision::gcd(b * b, a * a) == gcd * gcd);
+		REQUIRE(MultiPrecision::lcm(a, b) == a / gcd * b);
+		requireCoefficients(a, b);
+		requireCoefficients(b * b, a * a);
+	}
+}
+
+TEST_CASE("Unsigned square", "[unsigned]")
+{
+	MultiPrecision::Unsigned one(1);
+	SECTION("Small number")
+	{
+		REQUIRE(MultiPrecision::square(MultiPrecision::Unsigned("0xfeedbabefeedbabe")) == "0xfddc9b564fbddbada5e5e55c5404a504");
+	}
+	SECTION("Large numbers")
+	{
+		// (2^n - 2^m - 1)^2 == 2^2n - 2^(n + m + 1) - 2^(n + 1) + 2^2m + 2^(m + 1) + 1
+		for (std::size_t n : {1000, 10000, 40000, 400000}) {
+			std::size_t m = n / 3;
+			REQUIRE(
+				MultiPrecision::square((one << n) - (one << m) - one) ==
+				(one << 2 * n) - (one << (n + m + 1)) - (one << (n + 1)) + (one << 2 * m) + (one << (m + 1)) + one);
+		}
+	}
+}
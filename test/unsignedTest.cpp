@@ -1,9 +1,79 @@
 #define CATCH_CONFIG_MAIN
 #include "catch.hpp"
 
+#include "MultiPrecision/DigitDivisor.h"
+#include "MultiPrecision/LimbPool.h"
 #include "MultiPrecision/Unsigned.h"
+#include <algorithm>
 #include <sstream>
 
+TEST_CASE("Unsigned construction from built-in integer", "[unsigned]")
+{
+	SECTION("Zero")
+	{
+		REQUIRE(MultiPrecision::Unsigned(0ULL) == "0x0");
+	}
+	SECTION("Full width")
+	{
+		REQUIRE(MultiPrecision::Unsigned(0xfeedbabefeedbabeULL) == "0xfeedbabefeedbabe");
+	}
+}
+
+TEST_CASE("Unsigned copy and move", "[unsigned]")
+{
+	SECTION("Inline digits")
+	{
+		MultiPrecision::Unsigned testee("0xfeedbabefeedbabe");
+		MultiPrecision::Unsigned copy(testee);
+		MultiPrecision::Unsigned moved(std::move(testee));
+		REQUIRE(copy == "0xfeedbabefeedbabe");
+		REQUIRE(moved == "0xfeedbabefeedbabe");
+	}
+	SECTION("Heap allocated digits")
+	{
+		MultiPrecision::Unsigned testee("0x" + std::string(1000, 'f'));
+		MultiPrecision::Unsigned copy(testee);
+		MultiPrecision::Unsigned moved;
+		moved = std::move(testee);
+		REQUIRE(copy == "0x" + std::string(1000, 'f'));
+		REQUIRE(moved == "0x" + std::string(1000, 'f'));
+		moved = "0xfeedbabe";
+		REQUIRE(moved == "0xfeedbabe");
+	}
+}
+
+TEST_CASE("Unsigned digits allocated from limb pool", "[unsigned]")
+{
+	MultiPrecision::LimbPool pool;
+	MultiPrecision::Unsigned outside("0x" + std::string(100, 'f'));
+	{
+		MultiPrecision::LimbAllocator::Scope scope(pool);
+		MultiPrecision::Unsigned testee("0x" + std::string(1000, 'f'));
+		MultiPrecision::Unsigned result = testee * testee + outside;
+		result -= outside;
+		REQUIRE(result == (MultiPrecision::Unsigned(1) << 8000) - (MultiPrecision::Unsigned(1) << 4001) + MultiPrecision::Unsigned(1));
+		outside = result >> 4000;
+	}
+	pool.reset();
+	REQUIRE(&MultiPrecision::LimbAllocator::current() == &MultiPrecision::LimbAllocator::heap());
+	REQUIRE(outside == "0x" + std::string(999, 'f') + "e");
+}
+
+TEST_CASE("Digits copied with their limb allocator", "[unsigned]")
+{
+	using Adapter = MultiPrecision::LimbAllocator::Adapter<unsigned>;
+	MultiPrecision::LimbPool pool;
+	MultiPrecision::SmallVector<unsigned, 2, Adapter> testee([&pool]() {
+		MultiPrecision::LimbAllocator::Scope scope(pool);
+		return Adapter();
+	}());
+	testee.assign(100, 7);
+	MultiPrecision::SmallVector<unsigned, 2, Adapter> copy(testee);
+	REQUIRE(copy.get_allocator() == testee.get_allocator());
+	REQUIRE(copy.get_allocator() != Adapter());
+	REQUIRE(std::count(copy.begin(), copy.end(), 7u) == 100);
+}
+
 TEST_CASE("Unsigned addition", "[unsigned]")
 {
 	MultiPrecision::Unsigned testee("0xfeedbabefeedbabefeedbabefeedbabe");
@@ -154,6 +224,55 @@ TEST_CASE("Unsigned multiplication in place", "[unsigned]")
 		testee *= "0xbabefeedbabefeed";
 		REQUIRE(testee == "0xb9f6ebfbfa503ddc80b2a3c280b2a3c1c6bbb7c6866265e6");
 	}
+	SECTION("Same number")
+	{
+		testee *= testee;
+		REQUIRE(testee == "0xfddc9b564fbddbafa19f1c08f3805c6049a8660ef7c725b5a5e5e55c5404a504");
+	}
+}
+
+TEST_CASE("Unsigned multiplication of large numbers", "[unsigned]")
+{
+	// (2^m - 1) * (2^n - 1) == 2^(m + n) - 2^m - 2^n + 1 with all digits saturated, maximizing carries.
+	MultiPrecision::Unsigned one(1);
+	SECTION("Equal size numbers")
+	{
+		MultiPrecision::Unsigned testee = (one << 8192) - one;
+		REQUIRE(testee * testee == (one << 16384) - (one << 8193) + one);
+	}
+	SECTION("Equal size numbers beyond Toom-Cook thresholds")
+	{
+		MultiPrecision::Unsigned multiplicand = (one << 40000) - one;
+		MultiPrecision::Unsigned multiplier = (one << 40000) - (one << 20000) - one;
+		REQUIRE(multiplicand * multiplier == (one << 80000) - (one << 60000) - (one << 40001) + (one << 20000) + one);
+	}
+	SECTION("Equal size numbers beyond number theoretic transform threshold")
+	{
+		MultiPrecision::Unsigned multiplicand = (one << 400000) - one;
+		MultiPrecision::Unsigned multiplier = (one << 400000) - (one << 200000) - one;
+		REQUIRE(multiplicand * multiplier == (one << 800000) - (one << 600000) - (one << 400001) + (one << 200000) + one);
+	}
+	SECTION("Similar size numbers")
+	{
+		MultiPrecision::Unsigned multiplicand = (one << 6000) - one;
+		MultiPrecision::Unsigned multiplier = (one << 4500) - one;
+		REQUIRE(multiplicand * multiplier == (one << 10500) - (one << 6000) - (one << 4500) + one);
+	}
+	SECTION("Small and large number")
+	{
+		MultiPrecision::Unsigned multiplicand = (one << 1800) - one;
+		MultiPrecision::Unsigned multiplier = (one << 20000) - one;
+		REQUIRE(multiplicand * multiplier == (one << 21800) - (one << 20000) - (one << 1800) + one);
+	}
+	SECTION("Odd length and half length numbers")
+	{
+		// Lengths of 2s - 1 and s digits of 32 or 64 bits, leaving leading zero digits in the middle partial product.
+		for (std::size_t bits : {32, 64}) {
+			MultiPrecision::Unsigned multiplicand = (one << (81 * bits)) - one;
+			MultiPrecision::Unsigned multiplier = (one << (41 * bits)) - one;
+			REQUIRE(multiplicand * multiplier == (one << (122 * bits)) - (one << (81 * bits)) - (one << (41 * bits)) + one);
+		}
+	}
 }
 
 TEST_CASE("Unsigned division", "[unsigned]")
@@ -175,6 +294,45 @@ TEST_CASE("Unsigned division", "[unsigned]")
 	}
 }
 
+TEST_CASE("Unsigned division by DigitDivisor", "[unsigned]")
+{
+	MultiPrecision::Unsigned dividend(
+		"0xfeedbabefeedbabefeedbabefeedbabefeedbabefeedbabefeedbabefeedbabefeedbabefeedbabefeedbabefeedbabe");
+	SECTION("Small divisor")
+	{
+		MultiPrecision::DigitDivisor divisor(0xfe);
+		auto result = dividend.dividedBy(divisor);
+		REQUIRE(
+			result.quotient == "0x100ef99f2e4b7291121301af4e8bf393161b11cf8f0cf5971e2b3210100ef99f2e4b7291121301af4e8bf393161b11c");
+		REQUIRE(result.remainder == "0xf6");
+		REQUIRE((MultiPrecision::Unsigned(dividend) /= divisor) == result.quotient);
+		REQUIRE((MultiPrecision::Unsigned(dividend) %= divisor) == result.remainder);
+	}
+	SECTION("Divisor with most significant bit set")
+	{
+		auto max = std::numeric_limits<MultiPrecision::Unsigned::DigitType>::max();
+		MultiPrecision::Unsigned quotient = dividend * dividend;
+		MultiPrecision::Unsigned remainder(max - 1);
+		auto result = (quotient * MultiPrecision::Unsigned(max) + remainder).dividedBy(MultiPrecision::DigitDivisor(max));
+		REQUIRE(result.quotient == quotient);
+		REQUIRE(result.remainder == remainder);
+	}
+	SECTION("Repeated division")
+	{
+		MultiPrecision::DigitDivisor ten(10);
+		MultiPrecision::Unsigned n("1234567890123456789012345678901234567890");
+		for (int i = 0; i < 3; ++i) {
+			n /= ten;
+		}
+		REQUIRE(n == "1234567890123456789012345678901234567");
+		REQUIRE((n %= ten) == "0x7");
+	}
+	SECTION("Zero divisor")
+	{
+		REQUIRE_THROWS(MultiPrecision::DigitDivisor(0));
+	}
+}
+
 TEST_CASE("Unsigned division by divisor larger than dividend", "[unsigned]")
 {
 	MultiPrecision::Unsigned dividend("0x2");
@@ -259,6 +417,100 @@ TEST_CASE("Unsigned division need borrow", "[unsigned]")
 	REQUIRE(result.remainder == "0xffffffffffffffffffffffffffffffff");
 }
 
+TEST_CASE("Unsigned division of large numbers", "[unsigned]")
+{
+	// 2^mn - 1 + r == (2^m - 1) * (2^(m(n-1)) + ... + 2^m + 1) + r
+	MultiPrecision::Unsigned one(1);
+	for (std::size_t m : {1000, 10000, 40000}) {
+		MultiPrecision::Unsigned divisor = (one << m) - one;
+		MultiPrecision::Unsigned quotient;
+		for (std::size_t i = 0; i < 7; ++i) {
+			quotient += one << (i * m);
+		}
+		MultiPrecision::Unsigned remainder = (one << (m - 1)) + MultiPrecision::Unsigned("0xfeedbabefeedbabe");
+		MultiPrecision::Unsigned dividend = (one << (7 * m)) - one + remainder;
+		auto result = dividend.dividedBy(divisor);
+		REQUIRE(result.quotient == quotient);
+		REQUIRE(result.remainder == remainder);
+		REQUIRE(dividend / divisor == quotient);
+		REQUIRE(dividend % divisor == remainder);
+	}
+}
+
+TEST_CASE("Unsigned division of a dividend of many divisor lengths", "[unsigned]")
+{
+	MultiPrecision::Unsigned one(1);
+	MultiPrecision::Unsigned divisor = (one << 10000) + (one << 6000) + MultiPrecision::Unsigned("0xfeedbabefeedbabe");
+	MultiPrecision::Unsigned quotient = ((one << 200000) - one) / MultiPrecision::Unsigned(7);
+	MultiPrecision::Unsigned remainder = divisor - MultiPrecision::Unsigned("0xfeedbabe");
+	MultiPrecision::Unsigned dividend = divisor * quotient + remainder;
+	auto result = dividend.dividedBy(divisor);
+	REQUIRE(result.quotient * divisor + result.remainder == dividend);
+	REQUIRE(result.remainder < divisor);
+	REQUIRE(result.quotient == quotient);
+	REQUIRE(dividend / divisor == quotient);
+	REQUIRE(dividend % divisor == remainder);
+}
+
+TEST_CASE("Unsigned division by special forms", "[unsigned]")
+{
+	MultiPrecision::Unsigned one(1);
+	MultiPrecision::Unsigned remainder("0xfeedbabefeedbabefeedbabefeedbabefeedbabe");
+	for (std::size_t m : {640, 1001, 4096}) {
+		MultiPrecision::Unsigned quotient = (one << (2 * m + 5)) + MultiPrecision::Unsigned("0xfeedbabe");
+		SECTION("Power of two")
+		{
+			MultiPrecision::Unsigned divisor = one << m;
+			MultiPrecision::Unsigned dividend = quotient * divisor + remainder;
+			auto result = dividend.dividedBy(divisor);
+			REQUIRE(result.quotient == quotient);
+			REQUIRE(result.remainder == remainder);
+			REQUIRE(dividend.divPow2(m) == quotient);
+			REQUIRE(dividend.modPow2(m) == remainder);
+		}
+		SECTION("Power of two minus one")
+		{
+			MultiPrecision::Unsigned divisor = (one << m) - one;
+			MultiPrecision::Unsigned dividend = quotient * divisor + remainder;
+			REQUIRE(dividend / divisor == quotient);
+			REQUIRE(dividend % divisor == remainder);
+			REQUIRE(dividend.modMersenne(m) == remainder);
+			REQUIRE((dividend - remainder).modMersenne(m) == MultiPrecision::Unsigned());
+		}
+		SECTION("Power of two plus one")
+		{
+			MultiPrecision::Unsigned divisor = (one << m) + one;
+			MultiPrecision::Unsigned dividend = quotient * divisor + remainder;
+			MultiPrecision::Unsigned testee(dividend);
+			testee /= divisor;
+			REQUIRE(testee == quotient);
+			testee = dividend;
+			testee %= divisor;
+			REQUIRE(testee == remainder);
+			REQUIRE((dividend + divisor - remainder) % divisor == MultiPrecision::Unsigned());
+		}
+	}
+	SECTION("Small exponents")
+	{
+		MultiPrecision::Unsigned testee("0xfeedbabefeedbabe");
+		REQUIRE(testee.modPow2(0) == MultiPrecision::Unsigned());
+		REQUIRE(testee.divPow2(0) == testee);
+		REQUIRE(testee.modPow2(200) == testee);
+		REQUIRE(testee.divPow2(200) == MultiPrecision::Unsigned());
+		REQUIRE(testee.modMersenne(1) == MultiPrecision::Unsigned());
+		REQUIRE(testee.modMersenne(8) == testee % MultiPrecision::Unsigned("0xff"));
+		REQUIRE_THROWS(testee.modMersenne(0));
+	}
+	SECTION("Divisors with leading zero digits")
+	{
+		// Subtraction leaves leading zero digits.
+		MultiPrecision::Unsigned padding = (one << 4000) - one;
+		MultiPrecision::Unsigned dividend = padding - remainder;
+		REQUIRE(dividend / ((one + padding) - padding) == dividend);
+		REQUIRE(dividend % (((one << 640) + one + padding) - padding) == dividend % ((one << 640) + one));
+	}
+}
+
 TEST_CASE("Unsigned division in place operator", "[unsigned]")
 {
 	MultiPrecision::Unsigned testee(
@@ -404,6 +656,17 @@ TEST_CASE("Convert decimal string", "[unsigned]")
 		std::string number("1234567890123456789012345678901234567890");
 		REQUIRE(MultiPrecision::Unsigned::fromDecimal(number.begin(), number.end()) == "1234567890123456789012345678901234567890");
 	}
+	SECTION("Huge numbers")
+	{
+		MultiPrecision::Unsigned power(1);
+		for (int i = 0; i < 5000; ++i) {
+			power *= MultiPrecision::Unsigned(10);
+		}
+		std::string number = "1" + std::string(5000, '0');
+		REQUIRE(MultiPrecision::Unsigned::fromDecimal(number.begin(), number.end()) == power);
+		number = std::string(5000, '9');
+		REQUIRE(MultiPrecision::Unsigned::fromDecimal(number.begin(), number.end()) == power - MultiPrecision::Unsigned(1));
+	}
 }
 
 TEST_CASE("Convert hexadecimal string", "[unsigned]")
@@ -419,6 +682,12 @@ TEST_CASE("Convert hexadecimal string", "[unsigned]")
 		std::string number("feedbabefeedbabefeedbabefeedbabe");
 		REQUIRE(MultiPrecision::Unsigned::fromHexadecimal(number.begin(), number.end()) == "0xfeedbabefeedbabefeedbabefeedbabe");
 	}
+	SECTION("Uppercase")
+	{
+		std::string number("FEEDBABEfeedbabe");
+		REQUIRE(MultiPrecision::Unsigned::fromHexadecimal(number.begin(), number.end()) == "0xfeedbabefeedbabe");
+		REQUIRE(MultiPrecision::Unsigned("0XFEEDBABE") == "0xfeedbabe");
+	}
 }
 
 TEST_CASE("Convert octal string", "[unsigned]")
@@ -449,6 +718,19 @@ TEST_CASE("Convert to decimal string", "[unsigned]")
 		testee = "1234567890123456789012345678901234567890";
 		REQUIRE(testee.toDecimalString() == "1234567890123456789012345678901234567890");
 	}
+	SECTION("Huge numbers")
+	{
+		std::string power = "1" + std::string(5000, '0');
+		testee = power;
+		REQUIRE(testee.toDecimalString() == power);
+		REQUIRE((testee - MultiPrecision::Unsigned(1)).toDecimalString() == std::string(5000, '9'));
+		std::string digits;
+		for (int i = 0; i < 500; ++i) {
+			digits += "1234567890";
+		}
+		testee = digits;
+		REQUIRE(testee.toDecimalString() == digits);
+	}
 }
 
 TEST_CASE("Convert to hexadecimal string", "[unsigned]")
@@ -479,6 +761,103 @@ TEST_CASE("Convert to octal string", "[unsigned]")
 		testee = "012345670123456701234567012345670";
 		REQUIRE(testee.toOctalString() == "12345670123456701234567012345670");
 	}
+	SECTION("Huge number")
+	{
+		// 2^3000 - 1 has 1000 octal digits 7, straddling digit boundaries.
+		testee = (MultiPrecision::Unsigned(1) << 3000) - MultiPrecision::Unsigned(1);
+		REQUIRE(testee.toOctalString() == std::string(1000, '7'));
+		REQUIRE(testee == "0" + std::string(1000, '7'));
+	}
+}
+
+TEST_CASE("Convert to and from characters", "[unsigned]")
+{
+	MultiPrecision::Unsigned testee("1234567890123456789012345678901234567890");
+	char buffer[64];
+	SECTION("Decimal")
+	{
+		REQUIRE(testee.decimalDigitsUpperBound() >= 40);
+		auto result = testee.toChars(buffer, buffer + sizeof(buffer));
+		REQUIRE(result.ec == std::errc());
+		REQUIRE(std::string(buffer, result.ptr) == "1234567890123456789012345678901234567890");
+		MultiPrecision::Unsigned value;
+		auto parsed = MultiPrecision::Unsigned::fromChars(buffer, result.ptr, value);
+		REQUIRE(parsed.ec == std::errc());
+		REQUIRE(parsed.ptr == result.ptr);
+		REQUIRE(value == testee);
+	}
+	SECTION("Hexadecimal")
+	{
+		auto result = testee.toChars(buffer, buffer + sizeof(buffer), 16);
+		REQUIRE(std::string(buffer, result.ptr) == "3a0c92075c0dbf3b8acbc5f96ce3f0ad2");
+		std::string number("FEEDbabe!");
+		MultiPrecision::Unsigned value;
+		auto parsed = MultiPrecision::Unsigned::fromChars(number.data(), number.data() + number.size(), value, 16);
+		REQUIRE(parsed.ptr == number.data() + 8);
+		REQUIRE(value == "0xfeedbabe");
+	}
+	SECTION("Buffer too small")
+	{
+		auto result = testee.toChars(buffer, buffer + 39);
+		REQUIRE(result.ec == std::errc::value_too_large);
+		REQUIRE(result.ptr == buffer + 39);
+	}
+	SECTION("Buffer shorter than upper bound")
+	{
+		// 2^132 has 40 decimal digits, but 133 bits admit 41.
+		testee = MultiPrecision::Unsigned(1) << 132;
+		REQUIRE(testee.decimalDigitsUpperBound() == 41);
+		auto result = testee.toChars(buffer, buffer + 40);
+		REQUIRE(result.ec == std::errc());
+		REQUIRE(std::string(buffer, result.ptr) == "5444517870735015415413993718908291383296");
+		REQUIRE(testee.toChars(buffer, buffer + 39).ec == std::errc::value_too_large);
+		REQUIRE(MultiPrecision::Unsigned().toChars(buffer, buffer).ec == std::errc::value_too_large);
+		REQUIRE(std::string(buffer, MultiPrecision::Unsigned().toChars(buffer, buffer + 1).ptr) == "0");
+	}
+	SECTION("Invalid input")
+	{
+		std::string number("x1");
+		MultiPrecision::Unsigned value(7);
+		auto parsed = MultiPrecision::Unsigned::fromChars(number.data(), number.data() + number.size(), value);
+		REQUIRE(parsed.ec == std::errc::invalid_argument);
+		REQUIRE(parsed.ptr == number.data());
+		REQUIRE(value == "7");
+		REQUIRE(MultiPrecision::Unsigned::fromChars(number.data(), number.data(), value, 7).ec == std::errc::invalid_argument);
+		REQUIRE(testee.toChars(buffer, buffer + sizeof(buffer), 7).ec == std::errc::invalid_argument);
+	}
+}
+
+TEST_CASE("Convert to and from bytes", "[unsigned]")
+{
+	MultiPrecision::Unsigned testee("0x0102030405060708090a0b");
+	const unsigned char mostSignificantFirst[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+	const unsigned char leastSignificantFirst[] = {11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+	unsigned char buffer[12];
+	SECTION("Most significant first")
+	{
+		REQUIRE(testee.numberOfBytes() == 11);
+		testee.toBytes(buffer, sizeof(buffer));
+		REQUIRE(std::equal(buffer, buffer + sizeof(buffer), mostSignificantFirst));
+		REQUIRE(MultiPrecision::Unsigned::fromBytes(mostSignificantFirst, sizeof(mostSignificantFirst)) == testee);
+	}
+	SECTION("Least significant first")
+	{
+		auto order = MultiPrecision::Unsigned::ByteOrder::LEAST_SIGNIFICANT_FIRST;
+		testee.toBytes(buffer, sizeof(buffer), order);
+		REQUIRE(std::equal(buffer, buffer + sizeof(buffer), leastSignificantFirst));
+		REQUIRE(MultiPrecision::Unsigned::fromBytes(leastSignificantFirst, sizeof(leastSignificantFirst), order) == testee);
+	}
+	SECTION("Length too small")
+	{
+		REQUIRE_THROWS(testee.toBytes(buffer, 10));
+	}
+	SECTION("Digit access")
+	{
+		MultiPrecision::Unsigned copy;
+		copy.resize(testee.numberOfDigits());
+		std::copy(testee.digitData(), testee.digitData() + testee.numberOfDigits(), copy.digitData());
+		REQUIRE(copy == testee);
+	}
 }
 
 TEST_CASE("Number of digits", "[unsigned]")